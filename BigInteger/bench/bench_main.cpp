@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+
+#include "BigInteger.hpp"
+
+namespace {
+
+std::atomic<std::size_t> allocations{0};
+
+// The replacement operator new and both operator delete overloads at the
+// end of the file share these, which keeps the malloc/free pairing in one
+// place. They are not inlined, because GCC would otherwise see free()
+// applied to the result of operator new and warn with
+// -Wmismatched-new-delete, although the pairing is valid for replaced
+// operators.
+[[gnu::noinline]] void* allocate(std::size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void release(void* memory) noexcept { std::free(memory); }
+
+std::string random_digits(std::mt19937_64& rng, std::size_t count) {
+  std::uniform_int_distribution<int> digit(0, 9);
+  std::string result(count, '0');
+  for (char& c : result) {
+    c = static_cast<char>('0' + digit(rng));
+  }
+  result[0] = static_cast<char>('1' + digit(rng) % 9);
+  return result;
+}
+
+BigInteger random_limbs(std::mt19937_64& rng, std::size_t limbs) {
+  return BigInteger(random_digits(rng, 9 * limbs));
+}
+
+// Runs operation once per iteration and reports its allocations and the
+// operand size alongside the time.
+template <class Operation>
+void measure(benchmark::State& state, std::size_t limbs,
+             Operation operation) {
+  const std::size_t before = allocations.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(operation());
+  }
+  const std::size_t after = allocations.load(std::memory_order_relaxed);
+  state.counters["allocs/op"] = benchmark::Counter(
+      static_cast<double>(after - before), benchmark::Counter::kAvgIterations);
+  state.counters["limbs"] = static_cast<double>(limbs);
+}
+
+// Operand sizes in limbs, 1 up to 4^10 ~ 10^6.
+void limb_sizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->RangeMultiplier(4)->Range(1, 1 << 20);
+}
+
+void BM_Add(benchmark::State& state) {
+  std::mt19937_64 rng(1);
+  const auto n = static_cast<std::size_t>(state.range(0));
+  BigInteger a = random_limbs(rng, n);
+  BigInteger b = random_limbs(rng, n);
+  measure(state, n, [&] { return a + b; });
+}
+
+void BM_Multiply(benchmark::State& state) {
+  std::mt19937_64 rng(2);
+  const auto n = static_cast<std::size_t>(state.range(0));
+  BigInteger a = random_limbs(rng, n);
+  BigInteger b = random_limbs(rng, n);
+  measure(state, n, [&] { return a * b; });
+}
+
+// A 2n-limb dividend over an n-limb divisor.
+void BM_Divide(benchmark::State& state) {
+  std::mt19937_64 rng(3);
+  const auto n = static_cast<std::size_t>(state.range(0));
+  BigInteger a = random_limbs(rng, 2 * n);
+  BigInteger b = random_limbs(rng, n);
+  measure(state, n, [&] { return a / b; });
+}
+
+void BM_Sqrt(benchmark::State& state) {
+  std::mt19937_64 rng(4);
+  const auto n = static_cast<std::size_t>(state.range(0));
+  BigInteger a = random_limbs(rng, n);
+  measure(state, n, [&] { return sqrt(a); });
+}
+
+void BM_Parse(benchmark::State& state) {
+  std::mt19937_64 rng(5);
+  const auto n = static_cast<std::size_t>(state.range(0));
+  std::string text = random_digits(rng, 9 * n);
+  measure(state, n, [&] { return BigInteger(text); });
+}
+
+void BM_ToString(benchmark::State& state) {
+  std::mt19937_64 rng(6);
+  const auto n = static_cast<std::size_t>(state.range(0));
+  BigInteger a = random_limbs(rng, n);
+  measure(state, n, [&] { return a.to_string(); });
+}
+
+// Sized by n rather than limbs; n! has about n log10(n / e) / 9 limbs.
+void BM_Factorial(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  measure(state, factorial(n).length(), [&] { return factorial(n); });
+}
+
+BENCHMARK(BM_Add)->Apply(limb_sizes);
+BENCHMARK(BM_Multiply)->Apply(limb_sizes);
+BENCHMARK(BM_Divide)->Apply(limb_sizes);
+BENCHMARK(BM_Sqrt)->Apply(limb_sizes);
+BENCHMARK(BM_Parse)->Apply(limb_sizes);
+BENCHMARK(BM_ToString)->Apply(limb_sizes);
+BENCHMARK(BM_Factorial)->RangeMultiplier(4)->Range(4, 1 << 20);
+
+}  // namespace
+
+// Every allocation in the process goes through here, so each benchmark can
+// report how many its operation made.
+void* operator new(std::size_t size) { return allocate(size); }
+
+void operator delete(void* memory) noexcept { release(memory); }
+void operator delete(void* memory, std::size_t) noexcept { release(memory); }
+
+BENCHMARK_MAIN();
@@ -1,12 +1,20 @@
 #ifndef BIGINTEGER_H
 #define BIGINTEGER_H
 
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "LimbVector.hpp"
+
 class BigInteger {
  private:
-  std::vector<long long> digits_;
+  LimbVector digits_;
   bool is_negative_;
   static const size_t BASE = 1'000'000'000;
 
@@ -14,21 +22,93 @@ private:
   void normalize();
   void add_magnitude(const BigInteger&);
   void subtract_magnitude(const BigInteger&);
+  void subtract_magnitude_from(const BigInteger&);
+  void negate();
   int compare_magnitude(const BigInteger&) const;
 
+  // Kernels against a single limb 0 <= limb < BASE; divide_limb returns the
+  // remainder magnitude.
+  void add_limb(std::uint32_t limb, bool negative);
+  void multiply_limb(std::uint32_t limb, bool negative);
+  std::uint32_t divide_limb(std::uint32_t limb, bool negative);
+
+  // *this += (negative ? -1 : 1) * the magnitude in limbs[0, count).
+  void add_limbs(const std::uint32_t* limbs, std::size_t count, bool negative);
+  void accumulate_product(const BigInteger& a, const BigInteger& b,
+                          bool negative);
+
+  // Square root and remainder of a value with an even number of limbs and
+  // top limb at least BASE / 4.
+  static std::pair<BigInteger, BigInteger> sqrt_rem_normalized(
+      const BigInteger&);
+
+  friend class BarrettContext;
+  friend class BigIntegerBatch;
+  friend class BigIntegerView;
+  friend class MontgomeryContext;
+  template <std::size_t>
+  friend class StaticBigInteger;
+
  public:
+  // Operand sizes, in limbs, at which multiplication, division and gcd
+  // switch algorithm, the word count below which radix conversion falls
+  // back to schoolbook, and the product size from which multiplications
+  // and product trees split across threads. Shared by all BigInteger
+  // instances and not synchronized. Karatsuba needs operands of at least
+  // four limbs to make progress, so karatsuba_multiply values below 4 act
+  // as 4; likewise a burnikel_ziegler_divide of 0 acts as 1.
+  struct Thresholds {
+    std::size_t karatsuba_multiply = 40;
+    std::size_t toom3_multiply = 150;
+    std::size_t ntt_multiply = 3000;
+    std::size_t burnikel_ziegler_divide = 40;
+    std::size_t radix_conversion = 16;
+    std::size_t half_gcd = 100;
+    std::size_t parallel_multiply = 2000;
+  };
+
+  static Thresholds& thresholds();
+
+  // Threads available to large multiplications, the caller included. The
+  // default of 1 keeps all work on the calling thread. Must not change
+  // while operations are running.
+  static void set_thread_count(std::size_t count);
+  static std::size_t thread_count();
+
   BigInteger(long long n = 0);
   BigInteger(const std::string&);
   BigInteger(const char*);
   BigInteger(const BigInteger&);
+  // Leaves the moved-from BigInteger equal to zero.
+  BigInteger(BigInteger&&) noexcept;
 
   BigInteger& operator=(const BigInteger&) &;
+  BigInteger& operator=(BigInteger&&) & noexcept;
   BigInteger& operator+=(const BigInteger&);
   BigInteger& operator-=(const BigInteger&);
   BigInteger& operator*=(const BigInteger&);
   BigInteger& operator/=(const BigInteger&);
   BigInteger& operator%=(const BigInteger&);
+
+  // Bitwise operators act on the infinite two's-complement representation,
+  // word by word; shifts are arithmetic, so >> rounds toward -infinity.
+  BigInteger& operator&=(const BigInteger&);
+  BigInteger& operator|=(const BigInteger&);
   BigInteger& operator^=(const BigInteger&);
+  BigInteger& operator<<=(std::size_t bits);
+  BigInteger& operator>>=(std::size_t bits);
+
+  // *this += a * b and *this -= a * b without a temporary BigInteger.
+  // Small products accumulate row by row straight into the digits, larger
+  // ones through a per-thread scratch buffer.
+  BigInteger& add_product(const BigInteger& a, const BigInteger& b);
+  BigInteger& subtract_product(const BigInteger& a, const BigInteger& b);
+
+  BigInteger& operator+=(long long);
+  BigInteger& operator-=(long long);
+  BigInteger& operator*=(long long);
+  BigInteger& operator/=(long long);
+  BigInteger& operator%=(long long);
 
   BigInteger& operator++();
   BigInteger operator++(int);
@@ -37,28 +117,131 @@ private:
 
   int length() const;
   bool is_negative() const;
+  bool is_zero() const;
+  bool is_odd() const;
   int operator[](std::size_t) const;
-  BigInteger abs() const;
+  // |*this| restricted to limbs [from, to), and *this *= BASE^count.
+  BigInteger limb_slice(std::size_t from, std::size_t to) const;
+  void shift_limbs(std::size_t count);
+  BigInteger abs() const&;
+  BigInteger abs() &&;
+  // Bit counts of the magnitude.
+  std::size_t bit_length() const;
+  std::size_t popcount() const;
+
+  // The magnitude as little-endian 2^64 words (empty for zero), converted by
+  // divide-and-conquer in O(M(n) log n).
+  std::vector<std::uint64_t> to_words() const;
+  static BigInteger from_words(std::span<const std::uint64_t> words,
+                               bool negative = false);
+
+  std::string to_string() const;
 
   friend BigInteger operator+(const BigInteger&, const BigInteger&);
   friend BigInteger operator-(const BigInteger&, const BigInteger&);
   friend BigInteger operator*(const BigInteger&, const BigInteger&);
   friend BigInteger operator/(const BigInteger&, const BigInteger&);
   friend BigInteger operator%(const BigInteger&, const BigInteger&);
+  friend BigInteger operator&(const BigInteger&, const BigInteger&);
+  friend BigInteger operator|(const BigInteger&, const BigInteger&);
   friend BigInteger operator^(const BigInteger&, const BigInteger&);
+  friend BigInteger operator~(const BigInteger&);
+  friend BigInteger operator<<(const BigInteger&, std::size_t bits);
+  friend BigInteger operator>>(const BigInteger&, std::size_t bits);
+  friend BigInteger pow(const BigInteger& base, const BigInteger& exponent);
+
+  friend BigInteger operator+(BigInteger&&, const BigInteger&);
+  friend BigInteger operator+(const BigInteger&, BigInteger&&);
+  friend BigInteger operator+(BigInteger&&, BigInteger&&);
+  friend BigInteger operator-(BigInteger&&, const BigInteger&);
+  friend BigInteger operator-(const BigInteger&, BigInteger&&);
+  friend BigInteger operator-(BigInteger&&, BigInteger&&);
+  friend BigInteger operator*(BigInteger&&, const BigInteger&);
+  friend BigInteger operator*(const BigInteger&, BigInteger&&);
+  friend BigInteger operator*(BigInteger&&, BigInteger&&);
+
+  friend BigInteger operator+(const BigInteger&, long long);
+  friend BigInteger operator+(long long, const BigInteger&);
+  friend BigInteger operator-(const BigInteger&, long long);
+  friend BigInteger operator-(long long, const BigInteger&);
+  friend BigInteger operator*(const BigInteger&, long long);
+  friend BigInteger operator*(long long, const BigInteger&);
+  friend BigInteger operator/(const BigInteger&, long long);
+  friend BigInteger operator+(BigInteger&&, long long);
+  friend BigInteger operator-(BigInteger&&, long long);
+  friend BigInteger operator*(BigInteger&&, long long);
+  friend BigInteger operator/(BigInteger&&, long long);
+  // The remainder of a machine-integer division always fits a long long.
+  friend long long operator%(const BigInteger&, long long);
+
+  // Truncating division; the remainder takes the sign of the dividend.
+  friend std::pair<BigInteger, BigInteger> divmod(const BigInteger&,
+                                                  const BigInteger&);
+  // (a * b) % m with the product and quotient in scratch buffers.
+  friend BigInteger multiply_remainder(const BigInteger& a,
+                                       const BigInteger& b,
+                                       const BigInteger& m);
+  // Adds limb columns of each sign in 64-bit accumulators, then carries
+  // once.
+  friend BigInteger sum(std::span<const BigInteger> terms);
 
   std::strong_ordering operator<=>(const BigInteger&) const;
   bool operator==(const BigInteger&) const;
   bool operator!=(const BigInteger&) const;
+  std::strong_ordering operator<=>(long long) const;
+  bool operator==(long long) const;
+
+  // Non-negative gcd by Lehmer's algorithm on the two leading limbs, with a
+  // recursive half-gcd above thresholds().half_gcd limbs.
+  friend BigInteger gcd(const BigInteger&, const BigInteger&);
+  friend BigInteger lcm(const BigInteger&, const BigInteger&);
+  // (g, x, y) with a * x + b * y = g = gcd(a, b).
+  friend std::tuple<BigInteger, BigInteger, BigInteger> extended_gcd(
+      const BigInteger& a, const BigInteger& b);
 
   friend BigInteger sqrt(const BigInteger&);
+  // Floor square root by Zimmermann's recursive square root, paired with
+  // the remainder n - root * root.
+  friend std::pair<BigInteger, BigInteger> isqrt_rem(const BigInteger&);
+  // Truncated k-th root by Newton iteration from a leading-limb estimate;
+  // negative radicands need an odd k.
+  friend BigInteger nth_root(const BigInteger&, unsigned k);
+  // Rejects most non-squares by residues mod 64, 63, 65 and 11 before
+  // taking the root.
+  friend bool is_perfect_square(const BigInteger&);
 
   friend std::ostream& operator<<(std::ostream&, const BigInteger&);
   friend std::istream& operator>>(std::istream&, BigInteger&);
 
+  // std::to_chars-style decimal output; 9 * length() + 1 chars always
+  // suffice. Fails with value_too_large, leaving [first, last) unspecified.
+  friend std::to_chars_result to_chars(char* first, char* last,
+                                       const BigInteger&);
+  // Parses an optional '-' and a run of digits, stopping at the first other
+  // character. Fails with invalid_argument, leaving the value untouched.
+  friend std::from_chars_result from_chars(const char* first,
+                                           const char* last, BigInteger&);
+
+  // Combinatorial numbers, built from balanced product trees: factorial by
+  // prime swing, binomial and Catalan numbers from their prime
+  // factorizations, Fibonacci and Lucas numbers by fast doubling.
   friend BigInteger NthCatalan(int n);
   friend BigInteger NthFibonacci(std::size_t n);
+  friend BigInteger NthLucas(std::size_t n);
   friend BigInteger factorial(int n);
+  friend BigInteger binomial(int n, int k);
 };
 
+// Take no BigInteger argument, so argument-dependent lookup cannot find the
+// friend declarations alone.
+BigInteger NthCatalan(int n);
+BigInteger NthFibonacci(std::size_t n);
+BigInteger NthLucas(std::size_t n);
+BigInteger factorial(int n);
+BigInteger binomial(int n, int k);
+
+// Product of all factors, 1 for none, multiplied up a balanced tree.
+BigInteger product(std::span<const BigInteger> factors);
+BigInteger sum(std::span<const BigInteger> terms);
+
 #endif
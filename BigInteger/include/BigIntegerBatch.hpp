@@ -0,0 +1,55 @@
+#ifndef BIGINTEGER_BATCH_H
+#define BIGINTEGER_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BigInteger.hpp"
+
+// count integers of width base-1e9 limbs each, stored limb-major (limb i of
+// every number, then limb i + 1) so the kernels below step through many
+// numbers in lockstep, one SIMD lane each. Negative values are held as
+// BASE^width complements, which makes addition sign-blind; arithmetic
+// wraps modulo BASE^width, and width limbs hold |x| < BASE^width / 2.
+class BigIntegerBatch {
+ public:
+  BigIntegerBatch(std::size_t count, std::size_t width);
+  BigIntegerBatch(std::span<const BigInteger> values, std::size_t width);
+
+  std::size_t size() const { return count_; }
+  std::size_t width() const { return width_; }
+
+  // Throws std::overflow_error when value is out of range.
+  void set(std::size_t index, const BigInteger& value);
+  BigInteger get(std::size_t index) const;
+  std::vector<BigInteger> to_vector() const;
+
+  // Limb i of every number, count_ limbs long.
+  std::uint32_t* row(std::size_t i) { return limbs_.data() + i * count_; }
+  const std::uint32_t* row(std::size_t i) const {
+    return limbs_.data() + i * count_;
+  }
+
+ private:
+  std::size_t count_;
+  std::size_t width_;
+  std::vector<std::uint32_t> limbs_;
+};
+
+// Element-wise kernels over batches of equal size and width; out may be
+// either operand. They are compiled for AVX-512, AVX2 and baseline x86-64
+// where the compiler supports function multiversioning, and the best
+// version is picked at load time.
+void add_n(BigIntegerBatch& out, const BigIntegerBatch& a,
+           const BigIntegerBatch& b);
+void sub_n(BigIntegerBatch& out, const BigIntegerBatch& a,
+           const BigIntegerBatch& b);
+// out = a * factor for a single limb 0 <= factor < BASE.
+void mul_1(BigIntegerBatch& out, const BigIntegerBatch& a,
+           std::uint32_t factor);
+// -1, 0 or 1 per number as a[i] is less than, equal to or greater than b[i].
+std::vector<int> compare(const BigIntegerBatch& a, const BigIntegerBatch& b);
+
+#endif
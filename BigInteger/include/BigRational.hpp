@@ -0,0 +1,91 @@
+#ifndef BIG_RATIONAL_H
+#define BIG_RATIONAL_H
+
+#include <compare>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+#include "BigInteger.hpp"
+
+// An exact fraction of BigIntegers. The denominator is kept positive, but
+// the gcd reduction is deferred: arithmetic leaves common factors in place
+// until the numerator and denominator have grown by reduction_growth()
+// limbs since they were last reduced, or until a comparison, an accessor
+// or output needs the reduced form. Those reduce in place, which is why the
+// fields are mutable.
+class BigRational {
+ public:
+  // Combined limbs the fraction may grow by between reductions; 0 reduces
+  // after every operation. Shared by all BigRational instances and not
+  // synchronized.
+  static std::size_t& reduction_growth();
+
+  BigRational(long long numerator = 0);
+  BigRational(const BigInteger& numerator,
+              const BigInteger& denominator = 1LL);
+
+  // In lowest terms.
+  const BigInteger& numerator() const;
+  const BigInteger& denominator() const;
+  void reduce() const;
+
+  bool is_zero() const { return numerator_.is_zero(); }
+  bool is_negative() const { return numerator_.is_negative(); }
+
+  BigRational& operator+=(const BigRational&);
+  BigRational& operator-=(const BigRational&);
+  BigRational& operator*=(const BigRational&);
+  BigRational& operator/=(const BigRational&);
+
+  // Integers join without multiplying the denominators together.
+  BigRational& operator+=(const BigInteger&);
+  BigRational& operator-=(const BigInteger&);
+  BigRational& operator*=(const BigInteger&);
+  BigRational& operator/=(const BigInteger&);
+  BigRational& operator+=(long long other) {
+    return *this += BigInteger(other);
+  }
+  BigRational& operator-=(long long other) {
+    return *this -= BigInteger(other);
+  }
+  BigRational& operator*=(long long other) {
+    return *this *= BigInteger(other);
+  }
+  BigRational& operator/=(long long other) {
+    return *this /= BigInteger(other);
+  }
+
+  std::string to_string() const;
+
+  std::strong_ordering operator<=>(const BigRational&) const;
+  bool operator==(const BigRational&) const;
+
+  friend BigRational operator+(BigRational lhs, const BigRational& rhs) {
+    return lhs += rhs;
+  }
+  friend BigRational operator-(BigRational lhs, const BigRational& rhs) {
+    return lhs -= rhs;
+  }
+  friend BigRational operator*(BigRational lhs, const BigRational& rhs) {
+    return lhs *= rhs;
+  }
+  friend BigRational operator/(BigRational lhs, const BigRational& rhs) {
+    return lhs /= rhs;
+  }
+
+  friend std::ostream& operator<<(std::ostream&, const BigRational&);
+
+ private:
+  void add(const BigRational&, bool subtract);
+  void add(const BigInteger&, bool subtract);
+  // Fixes the sign and reduces once the growth allowance is used up.
+  void settle();
+
+  mutable BigInteger numerator_;
+  mutable BigInteger denominator_;
+  mutable std::size_t reduced_limbs_ = 0;
+  mutable bool is_reduced_ = false;
+};
+
+#endif
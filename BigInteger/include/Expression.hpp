@@ -0,0 +1,156 @@
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "BigInteger.hpp"
+
+// Deferred sums of products. lazy(a) * b + lazy(c) * d - e builds a
+// Sum<3> that, when converted or added to a BigInteger, accumulates every
+// term into one destination through add_product, without a temporary per
+// operator. (lazy(a) * b) % m runs as one multiply_remainder.
+//
+// Operands are held by pointer: evaluate an expression in the statement
+// that builds it rather than storing it with auto.
+namespace expression {
+
+// a * b, or a alone when b is null, negated when negative is set.
+struct Term {
+  const BigInteger* lhs;
+  const BigInteger* rhs;
+  bool negative;
+};
+
+template <std::size_t N>
+struct Sum {
+  std::array<Term, N> terms;
+
+  // References to target among the operands see its old value.
+  void add_to(BigInteger& target) const {
+    for (const Term& term : terms) {
+      if (term.lhs == &target || term.rhs == &target) {
+        target += BigInteger(*this);
+        return;
+      }
+    }
+    for (const Term& term : terms) {
+      if (term.rhs == nullptr && term.negative) {
+        target -= *term.lhs;
+      } else if (term.rhs == nullptr) {
+        target += *term.lhs;
+      } else if (term.negative) {
+        target.subtract_product(*term.lhs, *term.rhs);
+      } else {
+        target.add_product(*term.lhs, *term.rhs);
+      }
+    }
+  }
+
+  operator BigInteger() const {
+    BigInteger result;
+    add_to(result);
+    return result;
+  }
+};
+
+struct Value {
+  const BigInteger* value;
+};
+
+template <class T>
+struct is_lazy : std::false_type {};
+template <std::size_t N>
+struct is_lazy<Sum<N>> : std::true_type {};
+template <>
+struct is_lazy<Value> : std::true_type {};
+
+template <class T>
+concept Lazy = is_lazy<T>::value;
+
+template <class T>
+concept Operand = Lazy<T> || std::same_as<T, BigInteger>;
+
+inline Sum<1> to_sum(const BigInteger& value) {
+  return {{Term{&value, nullptr, false}}};
+}
+
+inline Sum<1> to_sum(Value value) {
+  return {{Term{value.value, nullptr, false}}};
+}
+
+template <std::size_t N>
+const Sum<N>& to_sum(const Sum<N>& sum) {
+  return sum;
+}
+
+template <std::size_t N, std::size_t M>
+Sum<N + M> concatenate(const Sum<N>& lhs, const Sum<M>& rhs, bool subtract) {
+  Sum<N + M> result;
+  for (std::size_t i = 0; i < N; ++i) {
+    result.terms[i] = lhs.terms[i];
+  }
+  for (std::size_t i = 0; i < M; ++i) {
+    result.terms[N + i] = rhs.terms[i];
+    result.terms[N + i].negative = rhs.terms[i].negative != subtract;
+  }
+  return result;
+}
+
+inline Sum<1> operator*(Value lhs, const BigInteger& rhs) {
+  return {{Term{lhs.value, &rhs, false}}};
+}
+
+inline Sum<1> operator*(const BigInteger& lhs, Value rhs) {
+  return {{Term{&lhs, rhs.value, false}}};
+}
+
+inline Sum<1> operator*(Value lhs, Value rhs) {
+  return {{Term{lhs.value, rhs.value, false}}};
+}
+
+template <Operand L, Operand R>
+  requires Lazy<L> || Lazy<R>
+auto operator+(const L& lhs, const R& rhs) {
+  return concatenate(to_sum(lhs), to_sum(rhs), false);
+}
+
+template <Operand L, Operand R>
+  requires Lazy<L> || Lazy<R>
+auto operator-(const L& lhs, const R& rhs) {
+  return concatenate(to_sum(lhs), to_sum(rhs), true);
+}
+
+template <Lazy E>
+auto operator-(const E& value) {
+  return concatenate(Sum<0>(), to_sum(value), true);
+}
+
+template <Lazy E>
+BigInteger& operator+=(BigInteger& target, const E& value) {
+  to_sum(value).add_to(target);
+  return target;
+}
+
+template <Lazy E>
+BigInteger& operator-=(BigInteger& target, const E& value) {
+  (-value).add_to(target);
+  return target;
+}
+
+// Truncated like BigInteger's operator%.
+inline BigInteger operator%(const Sum<1>& value, const BigInteger& modulus) {
+  const Term& term = value.terms[0];
+  BigInteger result =
+      term.rhs == nullptr ? *term.lhs % modulus
+                          : multiply_remainder(*term.lhs, *term.rhs, modulus);
+  return term.negative ? 0LL - result : result;
+}
+
+}  // namespace expression
+
+inline expression::Value lazy(const BigInteger& value) { return {&value}; }
+
+#endif
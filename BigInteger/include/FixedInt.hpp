@@ -0,0 +1,444 @@
+#ifndef FIXED_INT_H
+#define FIXED_INT_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BigInteger.hpp"
+
+// A Bits-wide integer in Bits / 64 two's-complement words on the stack.
+// Arithmetic wraps modulo 2^Bits, signed or not, like the built-in unsigned
+// types; every loop runs over a compile-time word count, so the compiler
+// unrolls it. Division truncates toward zero, as BigInteger does.
+template <std::size_t Bits, bool Signed>
+class FixedInt {
+  static_assert(Bits > 0 && Bits % 64 == 0,
+                "FixedInt width must be a positive multiple of 64 bits");
+
+ public:
+  static constexpr std::size_t WORDS = Bits / 64;
+
+ private:
+  using Word = std::uint64_t;
+  using DoubleWord = unsigned __int128;
+  using SignedDoubleWord = __int128;
+  using Words = std::array<Word, WORDS>;
+
+  Words words_{};
+
+  static constexpr std::size_t significant_words(const Words& x) {
+    std::size_t n = WORDS;
+    while (n > 0 && x[n - 1] == 0) {
+      --n;
+    }
+    return n;
+  }
+
+  // Knuth's Algorithm D on unsigned 2^64 words; b must be nonzero.
+  static constexpr void divide_unsigned(const Words& a, const Words& b,
+                                        Words& q, Words& r) {
+    q = {};
+    r = {};
+    const std::size_t n = significant_words(b);
+    const std::size_t m = significant_words(a);
+    if (m < n) {
+      r = a;
+      return;
+    }
+    if (n == 1) {
+      Word remainder = 0;
+      for (std::size_t i = m; i-- > 0;) {
+        DoubleWord current = (static_cast<DoubleWord>(remainder) << 64) | a[i];
+        q[i] = static_cast<Word>(current / b[0]);
+        remainder = static_cast<Word>(current % b[0]);
+      }
+      r[0] = remainder;
+      return;
+    }
+
+    // Shift so the divisor's top word has its high bit set.
+    const int shift = std::countl_zero(b[n - 1]);
+    std::array<Word, WORDS> v{};
+    std::array<Word, WORDS + 1> u{};
+    for (std::size_t i = n; i-- > 0;) {
+      v[i] = shift == 0 ? b[i]
+                        : b[i] << shift | (i > 0 ? b[i - 1] >> (64 - shift)
+                                                 : 0);
+    }
+    u[m] = shift == 0 ? 0 : a[m - 1] >> (64 - shift);
+    for (std::size_t i = m; i-- > 0;) {
+      u[i] = shift == 0 ? a[i]
+                        : a[i] << shift | (i > 0 ? a[i - 1] >> (64 - shift)
+                                                 : 0);
+    }
+
+    for (std::size_t j = m - n + 1; j-- > 0;) {
+      DoubleWord numerator = (static_cast<DoubleWord>(u[j + n]) << 64) |
+                             u[j + n - 1];
+      DoubleWord q_hat = numerator / v[n - 1];
+      DoubleWord r_hat = numerator % v[n - 1];
+      while (q_hat >> 64 != 0 ||
+             q_hat * v[n - 2] > ((r_hat << 64) | u[j + n - 2])) {
+        --q_hat;
+        r_hat += v[n - 1];
+        if (r_hat >> 64 != 0) {
+          break;
+        }
+      }
+
+      SignedDoubleWord t = 0;
+      Word borrow = 0;
+      for (std::size_t i = 0; i < n; ++i) {
+        DoubleWord p = q_hat * v[i];
+        t = static_cast<SignedDoubleWord>(u[i + j]) - borrow -
+            static_cast<Word>(p);
+        u[i + j] = static_cast<Word>(t);
+        borrow = static_cast<Word>(p >> 64) - static_cast<Word>(t >> 64);
+      }
+      t = static_cast<SignedDoubleWord>(u[j + n]) - borrow;
+      u[j + n] = static_cast<Word>(t);
+
+      // q_hat was one too large; add the divisor back.
+      if (t < 0) {
+        --q_hat;
+        Word carry = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+          DoubleWord sum = static_cast<DoubleWord>(u[i + j]) + v[i] + carry;
+          u[i + j] = static_cast<Word>(sum);
+          carry = static_cast<Word>(sum >> 64);
+        }
+        u[j + n] += carry;
+      }
+      q[j] = static_cast<Word>(q_hat);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+      r[i] = shift == 0 ? u[i] : u[i] >> shift | u[i + 1] << (64 - shift);
+    }
+  }
+
+  // Quotient and remainder truncated toward zero.
+  static constexpr std::pair<FixedInt, FixedInt> divide(const FixedInt& a,
+                                                        const FixedInt& b) {
+    if (b.is_zero()) {
+      throw std::invalid_argument("Division by zero");
+    }
+    FixedInt q;
+    FixedInt r;
+    divide_unsigned(a.abs().words_, b.abs().words_, q.words_, r.words_);
+    if (a.is_negative() != b.is_negative()) {
+      q = -q;
+    }
+    if (a.is_negative()) {
+      r = -r;
+    }
+    return {q, r};
+  }
+
+ public:
+  constexpr FixedInt() = default;
+
+  // Sign-extends signed sources and wraps values outside the range, like a
+  // built-in integer conversion.
+  template <std::integral T>
+  constexpr FixedInt(T value) {
+    words_[0] = static_cast<Word>(value);
+    const Word fill = std::is_signed_v<T> && value < 0 ? ~Word{0} : 0;
+    for (std::size_t i = 1; i < WORDS; ++i) {
+      words_[i] = fill;
+    }
+  }
+
+  // Lossless: throws std::overflow_error unless the value is in range.
+  explicit FixedInt(const BigInteger& value) {
+    const std::vector<Word> words = value.to_words();
+    if (words.size() > WORDS || (value.is_negative() && !Signed)) {
+      throw std::overflow_error("Value does not fit FixedInt");
+    }
+    std::copy(words.begin(), words.end(), words_.begin());
+    if (value.is_negative()) {
+      *this = -*this;
+    }
+    if (Signed && !value.is_zero() && is_negative() != value.is_negative()) {
+      throw std::overflow_error("Value does not fit FixedInt");
+    }
+  }
+
+  explicit FixedInt(const std::string& text) : FixedInt(BigInteger(text)) {}
+  explicit FixedInt(const char* text) : FixedInt(BigInteger(text)) {}
+
+  operator BigInteger() const {
+    const FixedInt magnitude = abs();
+    return BigInteger::from_words(magnitude.words_, is_negative());
+  }
+
+  static constexpr FixedInt max() {
+    FixedInt result = ~FixedInt();
+    if (Signed) {
+      result.words_[WORDS - 1] >>= 1;
+    }
+    return result;
+  }
+
+  static constexpr FixedInt min() { return ~max(); }
+
+  constexpr Word word(std::size_t index) const { return words_[index]; }
+
+  constexpr bool is_negative() const {
+    return Signed && words_[WORDS - 1] >> 63 != 0;
+  }
+
+  constexpr bool is_zero() const { return significant_words(words_) == 0; }
+  constexpr bool is_odd() const { return (words_[0] & 1) != 0; }
+
+  constexpr FixedInt abs() const { return is_negative() ? -*this : *this; }
+
+  // Bit counts of the magnitude, as for BigInteger.
+  constexpr std::size_t bit_length() const {
+    const FixedInt magnitude = abs();
+    const std::size_t n = significant_words(magnitude.words_);
+    return n == 0 ? 0 : 64 * (n - 1) + std::bit_width(magnitude.words_[n - 1]);
+  }
+
+  constexpr std::size_t popcount() const {
+    const FixedInt magnitude = abs();
+    std::size_t count = 0;
+    for (Word limb : magnitude.words_) {
+      count += std::popcount(limb);
+    }
+    return count;
+  }
+
+  std::string to_string() const { return BigInteger(*this).to_string(); }
+
+  constexpr FixedInt operator-() const { return ~*this + FixedInt(1); }
+
+  constexpr FixedInt operator~() const {
+    FixedInt result;
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      result.words_[i] = ~words_[i];
+    }
+    return result;
+  }
+
+  constexpr FixedInt& operator+=(const FixedInt& other) {
+    Word carry = 0;
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      const Word sum = words_[i] + other.words_[i];
+      const Word next = sum < words_[i];
+      words_[i] = sum + carry;
+      carry = next | (words_[i] < sum);
+    }
+    return *this;
+  }
+
+  constexpr FixedInt& operator-=(const FixedInt& other) {
+    Word borrow = 0;
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      const Word difference = words_[i] - other.words_[i];
+      const Word next = words_[i] < other.words_[i];
+      words_[i] = difference - borrow;
+      borrow = next | (difference < borrow);
+    }
+    return *this;
+  }
+
+  // Truncated schoolbook product; two's complement makes it sign-agnostic.
+  constexpr FixedInt& operator*=(const FixedInt& other) {
+    Words product{};
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      Word carry = 0;
+      for (std::size_t j = 0; i + j < WORDS; ++j) {
+        DoubleWord current =
+            static_cast<DoubleWord>(words_[i]) * other.words_[j] +
+            product[i + j] + carry;
+        product[i + j] = static_cast<Word>(current);
+        carry = static_cast<Word>(current >> 64);
+      }
+    }
+    words_ = product;
+    return *this;
+  }
+
+  constexpr FixedInt& operator/=(const FixedInt& other) {
+    return *this = divide(*this, other).first;
+  }
+
+  constexpr FixedInt& operator%=(const FixedInt& other) {
+    return *this = divide(*this, other).second;
+  }
+
+  constexpr FixedInt& operator&=(const FixedInt& other) {
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      words_[i] &= other.words_[i];
+    }
+    return *this;
+  }
+
+  constexpr FixedInt& operator|=(const FixedInt& other) {
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      words_[i] |= other.words_[i];
+    }
+    return *this;
+  }
+
+  constexpr FixedInt& operator^=(const FixedInt& other) {
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      words_[i] ^= other.words_[i];
+    }
+    return *this;
+  }
+
+  constexpr FixedInt& operator<<=(std::size_t bits) {
+    const std::size_t word_shift = bits / 64;
+    const unsigned bit_shift = bits % 64;
+    for (std::size_t i = WORDS; i-- > 0;) {
+      Word word = 0;
+      if (i >= word_shift) {
+        word = words_[i - word_shift] << bit_shift;
+        if (bit_shift != 0 && i > word_shift) {
+          word |= words_[i - word_shift - 1] >> (64 - bit_shift);
+        }
+      }
+      words_[i] = word;
+    }
+    return *this;
+  }
+
+  // Arithmetic for signed types, so negative values round toward -infinity.
+  constexpr FixedInt& operator>>=(std::size_t bits) {
+    const Word fill = is_negative() ? ~Word{0} : 0;
+    const std::size_t word_shift = bits / 64;
+    const unsigned bit_shift = bits % 64;
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      const std::size_t from = i + word_shift;
+      Word low = from < WORDS ? words_[from] : fill;
+      Word high = from + 1 < WORDS ? words_[from + 1] : fill;
+      words_[i] = bit_shift == 0 ? low
+                                 : low >> bit_shift | high << (64 - bit_shift);
+    }
+    return *this;
+  }
+
+  constexpr FixedInt& operator++() { return *this += FixedInt(1); }
+  constexpr FixedInt& operator--() { return *this -= FixedInt(1); }
+
+  constexpr FixedInt operator++(int) {
+    FixedInt old = *this;
+    ++*this;
+    return old;
+  }
+
+  constexpr FixedInt operator--(int) {
+    FixedInt old = *this;
+    --*this;
+    return old;
+  }
+
+  friend constexpr FixedInt operator+(FixedInt lhs, const FixedInt& rhs) {
+    return lhs += rhs;
+  }
+
+  friend constexpr FixedInt operator-(FixedInt lhs, const FixedInt& rhs) {
+    return lhs -= rhs;
+  }
+
+  friend constexpr FixedInt operator*(FixedInt lhs, const FixedInt& rhs) {
+    return lhs *= rhs;
+  }
+
+  friend constexpr FixedInt operator/(FixedInt lhs, const FixedInt& rhs) {
+    return lhs /= rhs;
+  }
+
+  friend constexpr FixedInt operator%(FixedInt lhs, const FixedInt& rhs) {
+    return lhs %= rhs;
+  }
+
+  friend constexpr FixedInt operator&(FixedInt lhs, const FixedInt& rhs) {
+    return lhs &= rhs;
+  }
+
+  friend constexpr FixedInt operator|(FixedInt lhs, const FixedInt& rhs) {
+    return lhs |= rhs;
+  }
+
+  friend constexpr FixedInt operator^(FixedInt lhs, const FixedInt& rhs) {
+    return lhs ^= rhs;
+  }
+
+  friend constexpr FixedInt operator<<(FixedInt value, std::size_t bits) {
+    return value <<= bits;
+  }
+
+  friend constexpr FixedInt operator>>(FixedInt value, std::size_t bits) {
+    return value >>= bits;
+  }
+
+  friend constexpr std::pair<FixedInt, FixedInt> divmod(const FixedInt& lhs,
+                                                        const FixedInt& rhs) {
+    return divide(lhs, rhs);
+  }
+
+  friend constexpr bool operator==(const FixedInt&, const FixedInt&) = default;
+
+  friend constexpr std::strong_ordering operator<=>(const FixedInt& lhs,
+                                                    const FixedInt& rhs) {
+    if (lhs.is_negative() != rhs.is_negative()) {
+      return lhs.is_negative() ? std::strong_ordering::less
+                               : std::strong_ordering::greater;
+    }
+    for (std::size_t i = WORDS; i-- > 0;) {
+      if (lhs.words_[i] != rhs.words_[i]) {
+        return lhs.words_[i] <=> rhs.words_[i];
+      }
+    }
+    return std::strong_ordering::equal;
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const FixedInt& value) {
+    return os << BigInteger(value);
+  }
+
+  // Sets failbit, leaving the value untouched, when the number is out of
+  // range.
+  friend std::istream& operator>>(std::istream& is, FixedInt& value) {
+    BigInteger parsed;
+    if (is >> parsed) {
+      try {
+        value = FixedInt(parsed);
+      } catch (const std::overflow_error&) {
+        is.setstate(std::ios::failbit);
+      }
+    }
+    return is;
+  }
+};
+
+using uint128 = FixedInt<128, false>;
+using uint256 = FixedInt<256, false>;
+using uint512 = FixedInt<512, false>;
+using uint1024 = FixedInt<1024, false>;
+using uint2048 = FixedInt<2048, false>;
+using uint4096 = FixedInt<4096, false>;
+
+using int128 = FixedInt<128, true>;
+using int256 = FixedInt<256, true>;
+using int512 = FixedInt<512, true>;
+using int1024 = FixedInt<1024, true>;
+using int2048 = FixedInt<2048, true>;
+using int4096 = FixedInt<4096, true>;
+
+#endif
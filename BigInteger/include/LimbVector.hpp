@@ -0,0 +1,136 @@
+#ifndef LIMB_VECTOR_H
+#define LIMB_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Contiguous storage for 32-bit limbs. Up to INLINE_CAPACITY limbs live
+// inside the object itself; longer values spill to the heap.
+class LimbVector {
+ public:
+  using value_type = std::uint32_t;
+  static constexpr std::size_t INLINE_CAPACITY = 4;
+
+  LimbVector() noexcept = default;
+
+  explicit LimbVector(std::size_t count, value_type value = 0) {
+    assign(count, value);
+  }
+
+  LimbVector(const LimbVector& other) {
+    reserve(other.size_);
+    std::copy(other.data(), other.data() + other.size_, data());
+    size_ = other.size_;
+  }
+
+  LimbVector(LimbVector&& other) noexcept { steal(other); }
+
+  LimbVector& operator=(const LimbVector& other) {
+    if (this != &other) {
+      size_ = 0;
+      reserve(other.size_);
+      std::copy(other.data(), other.data() + other.size_, data());
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  LimbVector& operator=(LimbVector&& other) noexcept {
+    if (this != &other) {
+      release();
+      steal(other);
+    }
+    return *this;
+  }
+
+  ~LimbVector() { release(); }
+
+  std::size_t size() const { return size_; }
+  std::size_t capacity() const { return heap_ ? capacity_ : INLINE_CAPACITY; }
+  bool empty() const { return size_ == 0; }
+
+  value_type* data() { return heap_ ? heap_ : inline_; }
+  const value_type* data() const { return heap_ ? heap_ : inline_; }
+
+  value_type& operator[](std::size_t index) { return data()[index]; }
+  value_type operator[](std::size_t index) const { return data()[index]; }
+
+  value_type& back() { return data()[size_ - 1]; }
+  value_type back() const { return data()[size_ - 1]; }
+
+  value_type* begin() { return data(); }
+  value_type* end() { return data() + size_; }
+  const value_type* begin() const { return data(); }
+  const value_type* end() const { return data() + size_; }
+
+  void reserve(std::size_t count) {
+    if (count <= capacity()) {
+      return;
+    }
+    std::size_t new_capacity = std::max(count, 2 * capacity());
+    value_type* storage = new value_type[new_capacity];
+    std::copy(data(), data() + size_, storage);
+    release();
+    heap_ = storage;
+    capacity_ = new_capacity;
+  }
+
+  void resize(std::size_t count, value_type value = 0) {
+    reserve(count);
+    if (count > size_) {
+      std::fill(data() + size_, data() + count, value);
+    }
+    size_ = count;
+  }
+
+  void assign(std::size_t count, value_type value) {
+    size_ = 0;
+    resize(count, value);
+  }
+
+  void push_back(value_type value) {
+    if (size_ == capacity()) {
+      reserve(size_ + 1);
+    }
+    data()[size_++] = value;
+  }
+
+  void pop_back() { --size_; }
+  void clear() { size_ = 0; }
+
+  void swap(LimbVector& other) noexcept {
+    LimbVector temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+
+ private:
+  void release() {
+    delete[] heap_;
+    heap_ = nullptr;
+    capacity_ = 0;
+  }
+
+  // Leaves other empty and inline.
+  void steal(LimbVector& other) noexcept {
+    size_ = other.size_;
+    if (other.heap_) {
+      heap_ = other.heap_;
+      capacity_ = other.capacity_;
+      other.heap_ = nullptr;
+      other.capacity_ = 0;
+    } else {
+      std::copy(other.inline_, other.inline_ + other.size_, inline_);
+    }
+    other.size_ = 0;
+  }
+
+  value_type* heap_ = nullptr;
+  std::size_t size_ = 0;
+  std::size_t capacity_ = 0;
+  value_type inline_[INLINE_CAPACITY];
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef MODULAR_H
+#define MODULAR_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "BigInteger.hpp"
+
+// Reduction contexts precompute the constants for one modulus, so repeated
+// products and powers modulo it avoid long division. Results are in [0, m).
+
+// Barrett reduction for any modulus m > 0 of k limbs: x mod m costs two
+// k-limb products against floor(BASE^(2k) / m).
+class BarrettContext {
+ public:
+  explicit BarrettContext(const BigInteger& modulus);
+
+  const BigInteger& modulus() const { return modulus_; }
+
+  // Any x is accepted; |x| < BASE^(2k), such as a product of two reduced
+  // values, takes the fast path.
+  BigInteger reduce(const BigInteger& x) const;
+  BigInteger multiply(const BigInteger& a, const BigInteger& b) const;
+  BigInteger pow(const BigInteger& base, const BigInteger& exponent) const;
+
+ private:
+  BigInteger modulus_;
+  BigInteger reciprocal_;
+  std::size_t limbs_;
+};
+
+// Montgomery reduction with R = BASE^k for a modulus of k limbs coprime to
+// 10. multiply() works on values in Montgomery form x * R mod m; pow()
+// converts in and out itself. Operands outside [0, m) are reduced first.
+class MontgomeryContext {
+ public:
+  explicit MontgomeryContext(const BigInteger& modulus);
+
+  const BigInteger& modulus() const { return modulus_; }
+
+  BigInteger to_montgomery(const BigInteger& x) const;
+  BigInteger from_montgomery(const BigInteger& x) const;
+  BigInteger multiply(const BigInteger& a, const BigInteger& b) const;
+  BigInteger pow(const BigInteger& base, const BigInteger& exponent) const;
+
+ private:
+  // t * R^-1 mod m for t < m * R, consuming the 2k + 1 limbs of t.
+  BigInteger reduce(LimbVector& t) const;
+  // x itself if it lies in [0, m), otherwise x mod m, kept in storage.
+  const BigInteger& in_range(const BigInteger& x, BigInteger& storage) const;
+
+  BigInteger modulus_;
+  BigInteger one_;
+  BigInteger r_squared_;
+  std::uint32_t inverse_;
+  std::size_t limbs_;
+};
+
+// One-off operations; powmod picks Montgomery for moduli coprime to 10 and
+// Barrett otherwise, and accepts negative exponents of invertible bases.
+BigInteger mulmod(const BigInteger& a, const BigInteger& b,
+                  const BigInteger& modulus);
+BigInteger powmod(const BigInteger& base, const BigInteger& exponent,
+                  const BigInteger& modulus);
+BigInteger invmod(const BigInteger& a, const BigInteger& modulus);
+
+#endif
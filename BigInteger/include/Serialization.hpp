@@ -0,0 +1,92 @@
+#ifndef BIGINTEGER_SERIALIZATION_H
+#define BIGINTEGER_SERIALIZATION_H
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "BigInteger.hpp"
+
+// Binary format, version 1: the magic "BGIN", a version byte, a flags byte
+// whose bit 0 marks big-endian limbs, and the value count as a LEB128
+// varint. Each value follows as the varint 2 * limbs + sign and then its
+// raw base-1e9 limbs, none for zero, so reading it back needs no decimal
+// parsing or radix conversion. Writers emit the host byte order; readers
+// accept either.
+
+// A read-only integer over limbs stored elsewhere: in a BigInteger, or in a
+// serialized buffer such as a memory-mapped file, where they may be
+// unaligned and in either byte order. It must not outlive that storage.
+class BigIntegerView {
+ public:
+  BigIntegerView(const BigInteger& value);
+  // size limbs of 4 bytes each starting at limbs, most significant last.
+  BigIntegerView(const std::byte* limbs, std::size_t size, bool negative,
+                 bool big_endian);
+
+  // Limb count, 0 for zero.
+  std::size_t size() const { return size_; }
+  bool is_negative() const { return is_negative_; }
+  bool is_zero() const { return size_ == 0; }
+  // Requires index < size().
+  std::uint32_t operator[](std::size_t index) const;
+  // The 4 * size() stored bytes, in the stored byte order.
+  const std::byte* data() const { return limbs_; }
+
+  // Copies the limbs out; throws std::invalid_argument if they do not form
+  // a canonical BigInteger.
+  explicit operator BigInteger() const;
+
+  friend std::strong_ordering operator<=>(const BigIntegerView&,
+                                          const BigIntegerView&);
+  friend bool operator==(const BigIntegerView&, const BigIntegerView&);
+
+ private:
+  const std::byte* limbs_;
+  std::size_t size_;
+  bool is_negative_;
+  // Whether the stored byte order differs from the host's.
+  bool swap_bytes_;
+};
+
+std::vector<std::byte> serialize(std::span<const BigInteger> values);
+void serialize(std::ostream& os, std::span<const BigInteger> values);
+
+// Both throw std::invalid_argument on a truncated or malformed buffer or an
+// unknown version. The views only check the structure and point into data;
+// deserialize also validates every limb.
+std::vector<BigInteger> deserialize(std::span<const std::byte> data);
+std::vector<BigIntegerView> deserialize_views(std::span<const std::byte> data);
+
+// A serialized file mapped read-only into memory, with a view of each value.
+// Opening reads only the varint headers; limbs are paged in as they are
+// used. Throws std::system_error if the file cannot be mapped.
+class MappedBigIntegers {
+ public:
+  explicit MappedBigIntegers(const std::string& path);
+  MappedBigIntegers(const MappedBigIntegers&) = delete;
+  MappedBigIntegers(MappedBigIntegers&&) noexcept;
+  ~MappedBigIntegers();
+
+  MappedBigIntegers& operator=(const MappedBigIntegers&) = delete;
+  MappedBigIntegers& operator=(MappedBigIntegers&&) noexcept;
+
+  std::size_t size() const { return views_.size(); }
+  const BigIntegerView& operator[](std::size_t index) const {
+    return views_[index];
+  }
+  std::span<const BigIntegerView> views() const { return views_; }
+
+ private:
+  void unmap();
+
+  void* data_ = nullptr;
+  std::size_t length_ = 0;
+  std::vector<BigIntegerView> views_;
+};
+
+#endif
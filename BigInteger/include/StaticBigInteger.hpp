@@ -0,0 +1,338 @@
+#ifndef STATIC_BIGINTEGER_H
+#define STATIC_BIGINTEGER_H
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+
+#include "BigInteger.hpp"
+
+// A signed integer of at most Capacity base-1e9 limbs held inline, so that
+// construction, + - *, and comparisons can all run in constant expressions.
+// The binary operators widen their result to a capacity that always holds
+// it; the compound ones keep Capacity and throw std::overflow_error on
+// overflow, which a constant expression reports at compile time.
+template <std::size_t Capacity>
+class StaticBigInteger {
+  static_assert(Capacity > 0, "StaticBigInteger needs at least one limb");
+
+ private:
+  using Limbs = std::array<std::uint32_t, Capacity>;
+
+  Limbs digits_{};
+  std::size_t size_ = 1;
+  bool is_negative_ = false;
+  static constexpr std::uint32_t BASE = 1'000'000'000;
+
+  template <std::size_t>
+  friend class StaticBigInteger;
+
+  // Takes limbs[0, count), trimmed of leading zeros, as the magnitude.
+  template <std::size_t Size>
+  constexpr void assign(const std::array<std::uint32_t, Size>& limbs,
+                        std::size_t count, bool negative) {
+    // Callers never pass more than Size. The explicit bound, and skipping
+    // the loop when a single limb leaves nothing to trim, let GCC see that
+    // the index stays inside limbs; otherwise -Warray-bounds fires.
+    count = std::min(count, Size);
+    if constexpr (Size > 1) {
+      while (count > 1 && limbs[count - 1] == 0) {
+        --count;
+      }
+    }
+    if (count > Capacity) {
+      throw std::overflow_error("StaticBigInteger capacity exceeded");
+    }
+    std::copy(limbs.begin(), limbs.begin() + count, digits_.begin());
+    std::fill(digits_.begin() + count, digits_.end(), 0);
+    size_ = count;
+    is_negative_ = negative && !is_zero();
+  }
+
+  template <std::size_t N, std::size_t M>
+  static constexpr int compare_magnitude(const StaticBigInteger<N>& a,
+                                         const StaticBigInteger<M>& b) {
+    if (a.size_ != b.size_) {
+      return a.size_ < b.size_ ? -1 : 1;
+    }
+    for (std::size_t i = a.size_; i-- > 0;) {
+      if (a.digits_[i] != b.digits_[i]) {
+        return a.digits_[i] < b.digits_[i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+ public:
+  // Kernels behind the operators, writing results of any operand capacity
+  // into this one. sum computes a + b, or a - b when subtract is set.
+  template <std::size_t N, std::size_t M>
+  static constexpr StaticBigInteger sum(const StaticBigInteger<N>& a,
+                                        const StaticBigInteger<M>& b,
+                                        bool subtract) {
+    const bool b_negative = b.is_negative_ != subtract;
+    std::array<std::uint32_t, std::max(N, M) + 1> limbs{};
+    bool negative = a.is_negative_;
+    std::size_t count = std::max(a.size_, b.size_) + 1;
+
+    if (a.is_negative_ == b_negative) {
+      std::uint32_t carry = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t digit = carry + (i < a.size_ ? a.digits_[i] : 0) +
+                              (i < b.size_ ? b.digits_[i] : 0);
+        carry = digit >= BASE;
+        limbs[i] = carry ? digit - BASE : digit;
+      }
+    } else {
+      // Subtract the smaller magnitude from the larger one.
+      const bool swap = compare_magnitude(a, b) < 0;
+      negative = swap ? b_negative : a.is_negative_;
+      std::uint32_t borrow = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t x = i < a.size_ ? a.digits_[i] : 0;
+        std::uint32_t y = i < b.size_ ? b.digits_[i] : 0;
+        if (swap) {
+          std::swap(x, y);
+        }
+        y += borrow;
+        borrow = x < y;
+        limbs[i] = borrow ? x + BASE - y : x - y;
+      }
+    }
+
+    StaticBigInteger result;
+    result.assign(limbs, count, negative);
+    return result;
+  }
+
+  template <std::size_t N, std::size_t M>
+  static constexpr StaticBigInteger product(const StaticBigInteger<N>& a,
+                                            const StaticBigInteger<M>& b) {
+    std::array<std::uint32_t, N + M> limbs{};
+    for (std::size_t i = 0; i < a.size_; ++i) {
+      std::uint64_t carry = 0;
+      for (std::size_t j = 0; j < b.size_; ++j) {
+        std::uint64_t current =
+            static_cast<std::uint64_t>(a.digits_[i]) * b.digits_[j] +
+            limbs[i + j] + carry;
+        limbs[i + j] = static_cast<std::uint32_t>(current % BASE);
+        carry = current / BASE;
+      }
+      limbs[i + b.size_] = static_cast<std::uint32_t>(carry);
+    }
+
+    StaticBigInteger result;
+    result.assign(limbs, a.size_ + b.size_, a.is_negative_ != b.is_negative_);
+    return result;
+  }
+
+  template <std::size_t N, std::size_t M>
+  static constexpr std::strong_ordering compare(const StaticBigInteger<N>& a,
+                                                const StaticBigInteger<M>& b) {
+    if (a.is_negative_ != b.is_negative_) {
+      return a.is_negative_ ? std::strong_ordering::less
+                            : std::strong_ordering::greater;
+    }
+    int magnitude = compare_magnitude(a, b);
+    return (a.is_negative_ ? -magnitude : magnitude) <=> 0;
+  }
+
+  constexpr StaticBigInteger() = default;
+
+  constexpr StaticBigInteger(long long number) {
+    std::array<std::uint32_t, 3> limbs{};
+    unsigned long long magnitude =
+        number < 0 ? 0ULL - static_cast<unsigned long long>(number)
+                   : static_cast<unsigned long long>(number);
+    for (std::uint32_t& limb : limbs) {
+      limb = static_cast<std::uint32_t>(magnitude % BASE);
+      magnitude /= BASE;
+    }
+    assign(limbs, limbs.size(), number < 0);
+  }
+
+  // An optional '-' and decimal digits, which may be grouped by the digit
+  // separator '\''.
+  constexpr explicit StaticBigInteger(std::string_view text) {
+    const bool negative = !text.empty() && text.front() == '-';
+    if (negative) {
+      text.remove_prefix(1);
+    }
+
+    Limbs limbs{};
+    std::size_t count = 0;
+    std::size_t digits = 0;
+    std::uint32_t limb = 0;
+    std::uint32_t scale = 1;
+    auto flush = [&] {
+      if (count < Capacity) {
+        limbs[count++] = limb;
+      } else if (limb != 0) {
+        throw std::overflow_error("StaticBigInteger capacity exceeded");
+      }
+      limb = 0;
+      scale = 1;
+    };
+    for (std::size_t i = text.size(); i-- > 0;) {
+      const char c = text[i];
+      if (c == '\'' && i > 0 && i + 1 < text.size()) {
+        continue;
+      }
+      if (c < '0' || c > '9') {
+        throw std::invalid_argument("Invalid number format");
+      }
+      limb += static_cast<std::uint32_t>(c - '0') * scale;
+      scale *= 10;
+      ++digits;
+      if (scale == BASE) {
+        flush();
+      }
+    }
+    if (digits == 0) {
+      throw std::invalid_argument("Empty string is not a valid number");
+    }
+    if (scale > 1) {
+      flush();
+    }
+    assign(limbs, count, negative);
+  }
+
+  // Widening is implicit; narrowing throws if the value does not fit.
+  template <std::size_t Other>
+  constexpr explicit(Other > Capacity)
+      StaticBigInteger(const StaticBigInteger<Other>& other) {
+    assign(other.digits_, other.size_, other.is_negative_);
+  }
+
+  static constexpr std::size_t capacity() { return Capacity; }
+  constexpr int length() const { return static_cast<int>(size_); }
+  constexpr bool is_negative() const { return is_negative_; }
+  constexpr bool is_zero() const { return size_ == 1 && digits_[0] == 0; }
+  constexpr int operator[](std::size_t index) const { return digits_[index]; }
+
+  constexpr StaticBigInteger operator-() const {
+    StaticBigInteger result = *this;
+    result.is_negative_ = !is_negative_ && !is_zero();
+    return result;
+  }
+
+  constexpr StaticBigInteger& operator+=(const StaticBigInteger& other) {
+    return *this = sum(*this, other, false);
+  }
+
+  constexpr StaticBigInteger& operator-=(const StaticBigInteger& other) {
+    return *this = sum(*this, other, true);
+  }
+
+  constexpr StaticBigInteger& operator*=(const StaticBigInteger& other) {
+    return *this = product(*this, other);
+  }
+
+  // Both types store trimmed base-1e9 limbs, zero as a single 0 limb, so
+  // the limbs are copied over as they are.
+  operator BigInteger() const {
+    BigInteger result;
+    result.digits_.resize(size_);
+    std::copy(digits_.begin(), digits_.begin() + size_,
+              result.digits_.data());
+    result.is_negative_ = is_negative_;
+    return result;
+  }
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const StaticBigInteger& value) {
+    return os << BigInteger(value);
+  }
+};
+
+// Large enough for any long long operand.
+using StaticLongLong = StaticBigInteger<3>;
+
+template <std::size_t N, std::size_t M>
+constexpr StaticBigInteger<std::max(N, M) + 1> operator+(
+    const StaticBigInteger<N>& lhs, const StaticBigInteger<M>& rhs) {
+  return StaticBigInteger<std::max(N, M) + 1>::sum(lhs, rhs, false);
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticBigInteger<std::max(N, M) + 1> operator-(
+    const StaticBigInteger<N>& lhs, const StaticBigInteger<M>& rhs) {
+  return StaticBigInteger<std::max(N, M) + 1>::sum(lhs, rhs, true);
+}
+
+template <std::size_t N, std::size_t M>
+constexpr StaticBigInteger<N + M> operator*(const StaticBigInteger<N>& lhs,
+                                            const StaticBigInteger<M>& rhs) {
+  return StaticBigInteger<N + M>::product(lhs, rhs);
+}
+
+template <std::size_t N>
+constexpr auto operator+(const StaticBigInteger<N>& lhs, long long rhs) {
+  return lhs + StaticLongLong(rhs);
+}
+
+template <std::size_t N>
+constexpr auto operator+(long long lhs, const StaticBigInteger<N>& rhs) {
+  return StaticLongLong(lhs) + rhs;
+}
+
+template <std::size_t N>
+constexpr auto operator-(const StaticBigInteger<N>& lhs, long long rhs) {
+  return lhs - StaticLongLong(rhs);
+}
+
+template <std::size_t N>
+constexpr auto operator-(long long lhs, const StaticBigInteger<N>& rhs) {
+  return StaticLongLong(lhs) - rhs;
+}
+
+template <std::size_t N>
+constexpr auto operator*(const StaticBigInteger<N>& lhs, long long rhs) {
+  return lhs * StaticLongLong(rhs);
+}
+
+template <std::size_t N>
+constexpr auto operator*(long long lhs, const StaticBigInteger<N>& rhs) {
+  return StaticLongLong(lhs) * rhs;
+}
+
+template <std::size_t N, std::size_t M>
+constexpr std::strong_ordering operator<=>(const StaticBigInteger<N>& lhs,
+                                           const StaticBigInteger<M>& rhs) {
+  return StaticBigInteger<N>::compare(lhs, rhs);
+}
+
+template <std::size_t N, std::size_t M>
+constexpr bool operator==(const StaticBigInteger<N>& lhs,
+                          const StaticBigInteger<M>& rhs) {
+  return StaticBigInteger<N>::compare(lhs, rhs) == 0;
+}
+
+template <std::size_t N>
+constexpr std::strong_ordering operator<=>(const StaticBigInteger<N>& lhs,
+                                           long long rhs) {
+  return StaticBigInteger<N>::compare(lhs, StaticLongLong(rhs));
+}
+
+template <std::size_t N>
+constexpr bool operator==(const StaticBigInteger<N>& lhs, long long rhs) {
+  return StaticBigInteger<N>::compare(lhs, StaticLongLong(rhs)) == 0;
+}
+
+// 123_big is a StaticBigInteger just wide enough for its digits, built at
+// compile time. Digit separators are allowed; other bases are not.
+template <char... Chars>
+consteval auto operator""_big() {
+  constexpr char text[] = {Chars...};
+  constexpr std::size_t digits =
+      sizeof...(Chars) - std::count(text, text + sizeof...(Chars), '\'');
+  return StaticBigInteger<(digits + 8) / 9>(
+      std::string_view(text, sizeof...(Chars)));
+}
+
+#endif
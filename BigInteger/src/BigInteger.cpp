@@ -1,24 +1,49 @@
 #include "BigInteger.hpp"
 
-#include <iomanip>
+#include <algorithm>
+#include <bit>
 #include <iostream>
 #include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "BinaryLimbs.hpp"
+#include "DecimalText.hpp"
+#include "Division.hpp"
+#include "Multiplication.hpp"
+#include "Parallel.hpp"
+
+namespace {
+
+unsigned long long magnitude_of(long long number) {
+  return number < 0 ? 0ULL - static_cast<unsigned long long>(number)
+                    : static_cast<unsigned long long>(number);
+}
+
+}  // namespace
+
+BigInteger::Thresholds& BigInteger::thresholds() {
+  static Thresholds thresholds;
+  return thresholds;
+}
+
+void BigInteger::set_thread_count(std::size_t count) {
+  detail::set_thread_count(count);
+}
+
+std::size_t BigInteger::thread_count() { return detail::thread_count(); }
 
 BigInteger::BigInteger(long long number) {
   if (number == 0) {
     digits_.push_back(0);
     is_negative_ = false;
   } else {
-    if (number < 0) {
-      is_negative_ = true;
-      number = -number;
-    } else {
-      is_negative_ = false;
-    }
+    is_negative_ = number < 0;
+    unsigned long long magnitude = magnitude_of(number);
 
-    while (number > 0) {
-      digits_.push_back(number % BASE);
-      number /= BASE;
+    while (magnitude > 0) {
+      digits_.push_back(magnitude % BASE);
+      magnitude /= BASE;
     }
   }
 }
@@ -28,37 +53,13 @@ BigInteger::BigInteger(const std::string& number) {
     throw std::invalid_argument("Empty string is not a valid number");
   }
 
-  is_negative_ = (number[0] == '-');
-  size_t start = is_negative_ ? 1 : 0;
-
-  if (start == number.size()) {
+  const char* last = number.data() + number.size();
+  auto [end, error] = from_chars(number.data(), last, *this);
+  if (error != std::errc()) {
     throw std::invalid_argument("Invalid number format");
   }
-
-  size_t chunk = 0;
-  size_t base_pow = 1;
-
-  for (size_t i = number.size(); i-- > start;) {
-    if (!std::isdigit(number[i])) {
-      throw std::invalid_argument("String contains non-digit characters");
-    }
-
-    chunk += (number[i] - '0') * base_pow;
-    base_pow *= 10;
-
-    if (base_pow == BASE) {
-      digits_.push_back(chunk);
-      chunk = 0;
-      base_pow = 1;
-    }
-  }
-
-  if (chunk > 0) {
-    digits_.push_back(chunk);
-  }
-
-  if (digits_.empty()) {
-    digits_.push_back(0);
+  if (end != last) {
+    throw std::invalid_argument("String contains non-digit characters");
   }
 }
 
@@ -67,6 +68,12 @@ BigInteger::BigInteger(const char* number) : BigInteger(std::string(number)) {}
 BigInteger::BigInteger(const BigInteger& other)
     : digits_(other.digits_), is_negative_(other.is_negative_) {}
 
+BigInteger::BigInteger(BigInteger&& other) noexcept
+    : digits_(std::move(other.digits_)), is_negative_(other.is_negative_) {
+  other.digits_.push_back(0);
+  other.is_negative_ = false;
+}
+
 BigInteger& BigInteger::operator=(const BigInteger& other) & {
   if (this != &other) {
     digits_ = other.digits_;
@@ -75,6 +82,12 @@ BigInteger& BigInteger::operator=(const BigInteger& other) & {
   return *this;
 }
 
+BigInteger& BigInteger::operator=(BigInteger&& other) & noexcept {
+  digits_.swap(other.digits_);
+  std::swap(is_negative_, other.is_negative_);
+  return *this;
+}
+
 std::strong_ordering BigInteger::operator<=>(const BigInteger& other) const {
   if (is_negative_ != other.is_negative_) {
     return is_negative_ ? std::strong_ordering::less
@@ -115,142 +128,116 @@ bool BigInteger::operator!=(const BigInteger& other) const {
   return !(*this == other);
 }
 
-BigInteger sqrt(const BigInteger& n)
-{
-  if (n < BigInteger(0LL)) {
-    throw std::invalid_argument("Square root of negative number is not supported.");
+std::strong_ordering BigInteger::operator<=>(long long other) const {
+  bool other_negative = other < 0;
+  if (is_negative_ != other_negative) {
+    return is_negative_ ? std::strong_ordering::less
+                        : std::strong_ordering::greater;
   }
 
-  if (n == BigInteger(0LL) || n == BigInteger(1LL)) {
-    return n;
+  std::uint32_t other_digits[3] = {};
+  size_t other_length = 0;
+  for (unsigned long long magnitude = magnitude_of(other); magnitude > 0;
+       magnitude /= BASE) {
+    other_digits[other_length++] = magnitude % BASE;
   }
+  other_length = std::max<size_t>(other_length, 1);
 
-  BigInteger left = 1LL;
-  BigInteger right = n;
-  BigInteger result = 0LL;
-
-  while (left <= right)
-  {
-    BigInteger mid = (left + right) / 2;
-    BigInteger midSquared = mid * mid;
-
-    if (midSquared == n)
-    {
-      return mid;
-    }
-
-    if (midSquared < n)
-    {
-      left = mid + 1;
-      result = mid;
-    } else {
-      right = mid - 1;
+  int magnitude_order = 0;
+  if (digits_.size() != other_length) {
+    magnitude_order = digits_.size() < other_length ? -1 : 1;
+  } else {
+    for (size_t i = other_length; i-- > 0;) {
+      if (digits_[i] != other_digits[i]) {
+        magnitude_order = digits_[i] < other_digits[i] ? -1 : 1;
+        break;
+      }
     }
   }
 
-  return result;
+  if (is_negative_) {
+    magnitude_order = -magnitude_order;
+  }
+  return magnitude_order <=> 0;
 }
 
-std::ostream &operator<<(std::ostream &os, const BigInteger &bi)
-{
-    if (bi.is_negative_ && !(bi.digits_.size() == 1 && bi.digits_[0] == 0))
-    {
-        os << '-';
-    }
-
-    if (bi.digits_.empty())
-    {
-        os << '0';
-        return os;
-    }
-
-    os << bi.digits_.back();
-
-    for (size_t i = bi.digits_.size() - 1; i-- > 0;)
-    {
-        // os << std::setw(BigInteger::BASE) << std::setfill('0') << bi.digits_[i];
-        os << bi.digits_[i];
-    }
-
-    return os;
+bool BigInteger::operator==(long long other) const {
+  return (*this <=> other) == std::strong_ordering::equal;
 }
 
-std::istream& operator>>(std::istream& is, BigInteger& bi) {
-  std::string input;
-  is >> input;
+std::string BigInteger::to_string() const {
+  std::string text(9 * digits_.size() + 1, '\0');
+  auto [end, error] = to_chars(text.data(), text.data() + text.size(), *this);
+  text.resize(end - text.data());
+  return text;
+}
 
-  if (input.empty() || (input[0] != '-' && !std::isdigit(input[0]))) {
-    is.setstate(std::ios::failbit);
-    return is;
+std::to_chars_result to_chars(char* first, char* last, const BigInteger& bi) {
+  const std::size_t n = bi.digits_.size();
+  const bool sign = bi.is_negative_ && !bi.is_zero();
+  const std::size_t length =
+      sign + detail::formatted_length(bi.digits_.data(), n);
+  if (static_cast<std::size_t>(last - first) < length) {
+    return {last, std::errc::value_too_large};
   }
 
-  bi.digits_.clear();
-  bi.is_negative_ = false;
-
-  size_t start = 0;
-  if (input[0] == '-') {
-    bi.is_negative_ = true;
-    start = 1;
+  if (sign) {
+    *first++ = '-';
   }
+  return {detail::format_limbs(bi.digits_.data(), n, first), std::errc()};
+}
 
-  for (size_t i = input.size(); i-- > start;) {
-    if (!std::isdigit(input[i])) {
-      is.setstate(std::ios::failbit);
-      return is;
-    }
-    bi.digits_.push_back(input[i] - '0');
+std::from_chars_result from_chars(const char* first, const char* last,
+                                  BigInteger& bi) {
+  const char* digits = first;
+  const bool negative = digits != last && *digits == '-';
+  digits += negative;
+  const char* end = detail::scan_digits(digits, last);
+  if (end == digits) {
+    return {first, std::errc::invalid_argument};
   }
 
+  const std::size_t count = end - digits;
+  bi.digits_.resize((count + 8) / 9);
+  detail::parse_limbs(digits, count, bi.digits_.data());
+  bi.is_negative_ = negative;
   bi.normalize();
-
-  return is;
+  return {end, std::errc()};
 }
 
-BigInteger factorial(int n) {
-  if (n < 0) {
-    throw std::invalid_argument("n must be non-negative");
+std::ostream& operator<<(std::ostream& os, const BigInteger& bi) {
+  char buffer[64];
+  if (bi.digits_.size() * 9 + 1 <= sizeof(buffer)) {
+    auto [end, error] = to_chars(buffer, buffer + sizeof(buffer), bi);
+    return os << std::string_view(buffer, end - buffer);
   }
-
-  BigInteger result = 1;
-  for (size_t i = 2; i <= n; ++i) {
-    result *= i;
-  }
-
-  return result;
+  return os << bi.to_string();
 }
 
-BigInteger NthCatalan(int n) {
-  if (n < 0) {
-    throw std::invalid_argument("n must be non-negative");
+std::istream& operator>>(std::istream& is, BigInteger& bi) {
+  std::string input;
+  if (!(is >> input)) {
+    return is;
   }
 
-  BigInteger num = factorial(2 * n);
-  BigInteger denom = factorial(n + 1) + factorial(n);
-  return num / denom;
-}
-
-BigInteger NthFibonacci(std::size_t n)
-{
-  if (n == 0) BigInteger(0ll);
-  if (n == 1) BigInteger(1ll);
-
-  BigInteger a = 0ll;
-  BigInteger b = 1ll;
-
-  for (size_t i = 2; i <= n; ++i)
-  {
-    BigInteger temp = a;
-    b += a;
-    a = temp;
+  const char* last = input.data() + input.size();
+  auto [end, error] = from_chars(input.data(), last, bi);
+  if (error != std::errc() || end != last) {
+    is.setstate(std::ios::failbit);
   }
-
-  return b;
+  return is;
 }
 
 int BigInteger::length() const { return digits_.size(); }
 
 bool BigInteger::is_negative() const { return is_negative_; }
 
+bool BigInteger::is_zero() const {
+  return digits_.size() == 1 && digits_[0] == 0;
+}
+
+bool BigInteger::is_odd() const { return digits_[0] % 2 != 0; }
+
 int BigInteger::operator[](std::size_t index) const {
   if (index >= digits_.size()) {
     throw std::out_of_range("Index out of bounds");
@@ -265,9 +252,8 @@ BigInteger& BigInteger::operator+=(const BigInteger& other) {
     if (compare_magnitude(other) >= 0) {
       subtract_magnitude(other);
     } else {
-      BigInteger temp = other;
-      temp.subtract_magnitude(*this);
-      *this = temp;
+      subtract_magnitude_from(other);
+      is_negative_ = other.is_negative_;
     }
   }
   normalize();
@@ -281,10 +267,8 @@ BigInteger& BigInteger::operator-=(const BigInteger& other) {
     if (compare_magnitude(other) >= 0) {
       subtract_magnitude(other);
     } else {
-      BigInteger temp = other;
-      temp.subtract_magnitude(*this);
-      temp.is_negative_ = !temp.is_negative_;
-      *this = temp;
+      subtract_magnitude_from(other);
+      is_negative_ = !other.is_negative_;
     }
   }
   normalize();
@@ -292,126 +276,177 @@ BigInteger& BigInteger::operator-=(const BigInteger& other) {
 }
 
 BigInteger& BigInteger::operator*=(const BigInteger& other) {
-  BigInteger result;
-  result.digits_.resize(length() + other.length(), 0);
-
-  for (size_t i = 0; i < length(); ++i) {
-    long long carry = 0;
-    for (size_t j = 0; j < other.length() || carry; ++j) {
-      long long current = result.digits_[i + j] +
-                          static_cast<long long>(operator[](i)) *
-                              (j < other.length() ? other[j] : 0) +
-                          carry;
-
-      result.digits_[i + j] = current % BASE;
-      carry = current / BASE;
-    }
-  }
+  LimbVector result(digits_.size() + other.digits_.size());
+  detail::multiply(digits_.data(), digits_.size(), other.digits_.data(),
+                   other.digits_.size(), result.data());
 
-  result.is_negative_ = is_negative() != other.is_negative();
-  result.normalize();
-  *this = result;
+  digits_ = std::move(result);
+  is_negative_ = is_negative_ != other.is_negative_;
+  normalize();
   return *this;
 }
 
 BigInteger& BigInteger::operator/=(const BigInteger& other) {
-  if (other == BigInteger(0LL)) {
+  *this = divmod(*this, other).first;
+  return *this;
+}
+
+BigInteger& BigInteger::operator%=(const BigInteger& other) {
+  *this = divmod(*this, other).second;
+  return *this;
+}
+
+std::pair<BigInteger, BigInteger> divmod(const BigInteger& dividend,
+                                         const BigInteger& divisor) {
+  if (divisor.is_zero()) {
     throw std::invalid_argument("Division by zero");
   }
 
-  BigInteger abs_current = this->abs();
-  BigInteger abs_other = other.abs();
+  if (dividend.compare_magnitude(divisor) < 0) {
+    return {BigInteger(), dividend};
+  }
 
-  BigInteger result;
-  result.digits_.resize(abs_current.length() - abs_other.length() + 1, 0);
-
-  BigInteger current;
-
-  for (size_t i = abs_current.length() - 1; i != static_cast<size_t>(-1); --i) {
-    current = current * BASE + abs_current.digits_[i];
-    int x = 0;
-    int left = 0;
-    int right = BASE - 1;
-
-    while (left <= right) {
-      int mid = (right + left) / 2;
-      BigInteger temp = abs_other * BigInteger(mid);
-      if (temp <= current) {
-        x = mid;
-        left = mid + 1;
-      } else {
-        right = mid - 1;
-      }
-    }
+  const std::size_t n = dividend.digits_.size();
+  const std::size_t m = divisor.digits_.size();
 
-    result.digits_[i] = x;
-    current = current - abs_other * BigInteger(x);
-  }
+  BigInteger quotient;
+  BigInteger remainder;
+  quotient.digits_.resize(n - m + 1);
+  remainder.digits_.resize(m);
+  detail::divide(dividend.digits_.data(), n, divisor.digits_.data(), m,
+                 quotient.digits_.data(), remainder.digits_.data());
 
-  result.is_negative_ = is_negative() != other.is_negative();
+  quotient.is_negative_ = dividend.is_negative_ != divisor.is_negative_;
+  remainder.is_negative_ = dividend.is_negative_;
+  quotient.normalize();
+  remainder.normalize();
+  return {std::move(quotient), std::move(remainder)};
+}
 
-  result.normalize();
+BigInteger& BigInteger::operator+=(long long other) {
+  unsigned long long magnitude = magnitude_of(other);
+  if (magnitude >= BASE) {
+    return *this += BigInteger(other);
+  }
+  add_limb(static_cast<std::uint32_t>(magnitude), other < 0);
+  return *this;
+}
 
-  *this = result;
+BigInteger& BigInteger::operator-=(long long other) {
+  unsigned long long magnitude = magnitude_of(other);
+  if (magnitude >= BASE) {
+    return *this -= BigInteger(other);
+  }
+  add_limb(static_cast<std::uint32_t>(magnitude), other > 0);
   return *this;
 }
 
-BigInteger& BigInteger::operator%=(const BigInteger& other) {
-  BigInteger quotient = *this / other;
-  *this -= quotient * other;
+BigInteger& BigInteger::operator*=(long long other) {
+  unsigned long long magnitude = magnitude_of(other);
+  if (magnitude >= BASE) {
+    return *this *= BigInteger(other);
+  }
+  multiply_limb(static_cast<std::uint32_t>(magnitude), other < 0);
   return *this;
 }
 
-BigInteger &BigInteger::operator^=(const BigInteger& other)
-{
-  if (other.is_negative_) {
-    throw std::invalid_argument("Negative exponent not supported");
+BigInteger& BigInteger::operator/=(long long other) {
+  unsigned long long magnitude = magnitude_of(other);
+  if (magnitude == 0) {
+    throw std::invalid_argument("Division by zero");
   }
+  if (magnitude >= BASE) {
+    return *this /= BigInteger(other);
+  }
+  divide_limb(static_cast<std::uint32_t>(magnitude), other < 0);
+  return *this;
+}
 
-  BigInteger base = *this;
-  BigInteger result = 1LL;
-  BigInteger exponent = other;
+BigInteger& BigInteger::operator%=(long long other) {
+  *this = BigInteger(*this % other);
+  return *this;
+}
 
-  while (exponent != BigInteger(0LL))
-  {
-    if (exponent % 2 == 1)
-    {
-      result *= base;
+void BigInteger::add_limb(std::uint32_t limb, bool negative) {
+  if (limb == 0) {
+    return;
+  }
+  if (is_zero()) {
+    digits_[0] = limb;
+    is_negative_ = negative;
+    return;
+  }
+
+  if (is_negative_ == negative) {
+    for (size_t i = 0; limb != 0; ++i) {
+      if (i == digits_.size()) {
+        digits_.push_back(limb);
+        break;
+      }
+      digits_[i] += limb;
+      limb = digits_[i] >= BASE;
+      if (limb) {
+        digits_[i] -= BASE;
+      }
+    }
+  } else if (digits_.size() > 1 || digits_[0] >= limb) {
+    for (size_t i = 0; limb != 0; ++i) {
+      std::uint32_t borrow = digits_[i] < limb;
+      digits_[i] = borrow ? digits_[i] + BASE - limb : digits_[i] - limb;
+      limb = borrow;
     }
-    base *= base;
-    exponent /= BigInteger(2LL);
+    normalize();
+  } else {
+    digits_[0] = limb - digits_[0];
+    is_negative_ = negative;
   }
+}
 
-  *this = result;
-  return *this;
+void BigInteger::multiply_limb(std::uint32_t limb, bool negative) {
+  std::uint32_t carry = detail::mul_by_limb(digits_.data(), digits_.size(),
+                                            limb, digits_.data());
+  if (carry != 0) {
+    digits_.push_back(carry);
+  }
+  is_negative_ = is_negative_ != negative;
+  normalize();
+}
+
+std::uint32_t BigInteger::divide_limb(std::uint32_t limb, bool negative) {
+  std::uint32_t remainder = detail::divide_by_limb(
+      digits_.data(), digits_.size(), limb, digits_.data());
+  is_negative_ = is_negative_ != negative;
+  normalize();
+  return remainder;
 }
 
 void BigInteger::add_magnitude(const BigInteger& other) {
-  size_t max_length = std::max(length(), other.length());
-  digits_.resize(max_length, 0);
-  int carry = 0;
-  for (size_t i = 0; i < max_length || carry != 0; ++i) {
-    if (i == digits_.size()) {
-      digits_.push_back(0);
-    }
-    digits_[i] += (i < other.length() ? other.digits_[i] : 0) + carry;
-    carry = digits_[i] >= BASE;
-    if (carry) {
-      digits_[i] -= BASE;
-    }
+  size_t other_length = other.digits_.size();
+  if (digits_.size() < other_length) {
+    digits_.resize(other_length, 0);
+  }
+  std::uint32_t carry = detail::add_in_place(
+      digits_.data(), digits_.size(), other.digits_.data(), other_length);
+  if (carry != 0) {
+    digits_.push_back(carry);
   }
 }
 
 void BigInteger::subtract_magnitude(const BigInteger& other) {
-  int borrow = 0;
-  for (size_t i = 0; i < length(); ++i) {
-    digits_[i] -= (i < other.length() ? other.digits_[i] : 0) + borrow;
-    if (digits_[i] < 0) {
-      digits_[i] += BASE;
-      borrow = 1;
-    } else {
-      borrow = 0;
-    }
+  detail::sub_in_place(digits_.data(), digits_.size(), other.digits_.data(),
+                       other.digits_.size());
+}
+
+// *this = |other| - |*this|, given |other| > |*this|.
+void BigInteger::subtract_magnitude_from(const BigInteger& other) {
+  digits_.resize(other.digits_.size(), 0);
+  detail::sub_from_in_place(digits_.data(), other.digits_.data(),
+                            digits_.size());
+}
+
+void BigInteger::negate() {
+  if (!is_zero()) {
+    is_negative_ = !is_negative_;
   }
 }
 
@@ -436,12 +471,58 @@ void BigInteger::normalize() {
   }
 }
 
-BigInteger BigInteger::abs() const {
+BigInteger BigInteger::abs() const& {
   BigInteger res = *this;
   res.is_negative_ = false;
   return res;
 }
 
+BigInteger BigInteger::abs() && {
+  is_negative_ = false;
+  return std::move(*this);
+}
+
+BigInteger BigInteger::limb_slice(std::size_t from, std::size_t to) const {
+  to = std::min(to, digits_.size());
+  BigInteger result;
+  if (from < to) {
+    result.digits_.assign(to - from, 0);
+    std::copy(digits_.begin() + from, digits_.begin() + to,
+              result.digits_.begin());
+    result.normalize();
+  }
+  return result;
+}
+
+void BigInteger::shift_limbs(std::size_t count) {
+  if (count == 0 || is_zero()) {
+    return;
+  }
+  const std::size_t n = digits_.size();
+  digits_.resize(n + count);
+  std::copy_backward(digits_.begin(), digits_.begin() + n, digits_.end());
+  std::fill(digits_.begin(), digits_.begin() + count, 0);
+}
+
+std::vector<std::uint64_t> BigInteger::to_words() const {
+  return detail::limbs_to_words(digits_.data(), digits_.size(),
+                                thresholds().radix_conversion);
+}
+
+BigInteger BigInteger::from_words(std::span<const std::uint64_t> words,
+                                  bool negative) {
+  std::vector<detail::Limb> limbs = detail::words_to_limbs(
+      words.data(), words.size(), thresholds().radix_conversion);
+
+  BigInteger result;
+  if (!limbs.empty()) {
+    result.digits_.resize(limbs.size());
+    std::copy(limbs.begin(), limbs.end(), result.digits_.begin());
+    result.is_negative_ = negative;
+  }
+  return result;
+}
+
 BigInteger operator+(const BigInteger& lhs, const BigInteger& rhs) {
   BigInteger result = lhs;
   result += rhs;
@@ -460,6 +541,52 @@ BigInteger operator*(const BigInteger& lhs, const BigInteger& rhs) {
   return copy;
 }
 
+BigInteger operator+(BigInteger&& lhs, const BigInteger& rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+BigInteger operator+(const BigInteger& lhs, BigInteger&& rhs) {
+  rhs += lhs;
+  return std::move(rhs);
+}
+
+BigInteger operator+(BigInteger&& lhs, BigInteger&& rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+BigInteger operator-(BigInteger&& lhs, const BigInteger& rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+BigInteger operator-(const BigInteger& lhs, BigInteger&& rhs) {
+  rhs -= lhs;
+  rhs.negate();
+  return std::move(rhs);
+}
+
+BigInteger operator-(BigInteger&& lhs, BigInteger&& rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+BigInteger operator*(BigInteger&& lhs, const BigInteger& rhs) {
+  lhs *= rhs;
+  return std::move(lhs);
+}
+
+BigInteger operator*(const BigInteger& lhs, BigInteger&& rhs) {
+  rhs *= lhs;
+  return std::move(rhs);
+}
+
+BigInteger operator*(BigInteger&& lhs, BigInteger&& rhs) {
+  lhs *= rhs;
+  return std::move(lhs);
+}
+
 BigInteger operator/(const BigInteger& lhs, const BigInteger& rhs) {
   BigInteger copy = lhs;
   copy /= rhs;
@@ -473,15 +600,108 @@ BigInteger operator%(const BigInteger& lhs, const BigInteger& rhs)
   return copy;
 }
 
-BigInteger operator^(const BigInteger& lhs, const BigInteger& rhs)
-{
-  BigInteger copy = lhs;
-  copy ^= rhs;
-  return copy;
+BigInteger pow(const BigInteger& base, const BigInteger& exponent) {
+  if (exponent.is_negative_) {
+    throw std::invalid_argument("Negative exponent not supported");
+  }
+
+  const std::vector<std::uint64_t> words = exponent.to_words();
+  BigInteger square = base;
+  BigInteger result = 1LL;
+
+  const std::size_t bits =
+      words.empty() ? 0
+                    : 64 * (words.size() - 1) + std::bit_width(words.back());
+  for (std::size_t i = 0; i < bits; ++i) {
+    if ((words[i / 64] >> (i % 64)) & 1) {
+      result *= square;
+    }
+    if (i + 1 < bits) {
+      square *= square;
+    }
+  }
+
+  return result;
+}
+
+BigInteger operator+(const BigInteger& lhs, long long rhs) {
+  BigInteger result = lhs;
+  result += rhs;
+  return result;
+}
+
+BigInteger operator+(long long lhs, const BigInteger& rhs) { return rhs + lhs; }
+
+BigInteger operator-(const BigInteger& lhs, long long rhs) {
+  BigInteger result = lhs;
+  result -= rhs;
+  return result;
+}
+
+BigInteger operator-(long long lhs, const BigInteger& rhs) {
+  BigInteger result = rhs;
+  result -= lhs;
+  result.negate();
+  return result;
+}
+
+BigInteger operator*(const BigInteger& lhs, long long rhs) {
+  BigInteger result = lhs;
+  result *= rhs;
+  return result;
+}
+
+BigInteger operator*(long long lhs, const BigInteger& rhs) { return rhs * lhs; }
+
+BigInteger operator/(const BigInteger& lhs, long long rhs) {
+  BigInteger result = lhs;
+  result /= rhs;
+  return result;
+}
+
+BigInteger operator+(BigInteger&& lhs, long long rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+BigInteger operator-(BigInteger&& lhs, long long rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+BigInteger operator*(BigInteger&& lhs, long long rhs) {
+  lhs *= rhs;
+  return std::move(lhs);
+}
+
+BigInteger operator/(BigInteger&& lhs, long long rhs) {
+  lhs /= rhs;
+  return std::move(lhs);
+}
+
+long long operator%(const BigInteger& lhs, long long rhs) {
+  unsigned long long magnitude = magnitude_of(rhs);
+  if (magnitude == 0) {
+    throw std::invalid_argument("Division by zero");
+  }
+
+  unsigned long long remainder = 0;
+  if (magnitude < BigInteger::BASE) {
+    remainder = detail::remainder_by_limb(
+        lhs.digits_.data(), lhs.digits_.size(),
+        static_cast<std::uint32_t>(magnitude));
+  } else {
+    BigInteger wide = divmod(lhs, BigInteger(rhs)).second;
+    for (size_t i = wide.digits_.size(); i-- > 0;) {
+      remainder = remainder * BigInteger::BASE + wide.digits_[i];
+    }
+  }
+  return lhs.is_negative_ ? -static_cast<long long>(remainder)
+                          : static_cast<long long>(remainder);
 }
 
 BigInteger& BigInteger::operator++() {
-  *this += BigInteger(1);
+  add_limb(1, false);
   return *this;
 }
 
@@ -492,7 +712,7 @@ BigInteger BigInteger::operator++(int) {
 }
 
 BigInteger& BigInteger::operator--() {
-  *this -= BigInteger(1);
+  add_limb(1, true);
   return *this;
 }
 
@@ -0,0 +1,203 @@
+#include "BigIntegerBatch.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "LimbArithmetic.hpp"
+
+// Function multiversioning: one clone per instruction set, dispatched by the
+// dynamic loader. The lane loops are written for the auto-vectorizer.
+#if defined(__x86_64__) && defined(__GNUC__) && defined(__linux__)
+#define BATCH_KERNEL \
+  __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define BATCH_KERNEL
+#endif
+
+namespace {
+
+using detail::BASE;
+using detail::Limb;
+
+// Numbers processed together, so the per-lane carries stay in L1.
+constexpr std::size_t BLOCK = 512;
+
+// The top limb of a negative number's complement is at least HALF.
+constexpr Limb HALF = BASE / 2;
+
+// x = BASE^n - x in place.
+void complement(Limb* x, std::size_t n) {
+  Limb borrow = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    Limb subtrahend = x[i] + borrow;
+    borrow = subtrahend != 0;
+    x[i] = borrow ? BASE - subtrahend : 0;
+  }
+}
+
+BATCH_KERNEL void add_lanes(const Limb* a, const Limb* b, Limb* out,
+                            std::size_t count, std::size_t width) {
+  for (std::size_t first = 0; first < count; first += BLOCK) {
+    const std::size_t lanes = std::min(BLOCK, count - first);
+    Limb carry[BLOCK] = {};
+    for (std::size_t i = 0; i < width; ++i) {
+      const std::size_t offset = i * count + first;
+      for (std::size_t j = 0; j < lanes; ++j) {
+        Limb current = a[offset + j] + b[offset + j] + carry[j];
+        carry[j] = current >= BASE;
+        out[offset + j] = current - carry[j] * BASE;
+      }
+    }
+  }
+}
+
+BATCH_KERNEL void sub_lanes(const Limb* a, const Limb* b, Limb* out,
+                            std::size_t count, std::size_t width) {
+  for (std::size_t first = 0; first < count; first += BLOCK) {
+    const std::size_t lanes = std::min(BLOCK, count - first);
+    Limb borrow[BLOCK] = {};
+    for (std::size_t i = 0; i < width; ++i) {
+      const std::size_t offset = i * count + first;
+      for (std::size_t j = 0; j < lanes; ++j) {
+        Limb subtrahend = b[offset + j] + borrow[j];
+        borrow[j] = a[offset + j] < subtrahend;
+        out[offset + j] = a[offset + j] - subtrahend + borrow[j] * BASE;
+      }
+    }
+  }
+}
+
+BATCH_KERNEL void mul_lanes(const Limb* a, Limb factor, Limb* out,
+                            std::size_t count, std::size_t width) {
+  for (std::size_t first = 0; first < count; first += BLOCK) {
+    const std::size_t lanes = std::min(BLOCK, count - first);
+    Limb carry[BLOCK] = {};
+    for (std::size_t i = 0; i < width; ++i) {
+      const std::size_t offset = i * count + first;
+      for (std::size_t j = 0; j < lanes; ++j) {
+        detail::DoubleLimb current =
+            static_cast<detail::DoubleLimb>(a[offset + j]) * factor +
+            carry[j];
+        carry[j] = static_cast<Limb>(current / BASE);
+        out[offset + j] = static_cast<Limb>(current % BASE);
+      }
+    }
+  }
+}
+
+// Biasing the top limbs by HALF orders complements below non-negatives.
+BATCH_KERNEL void compare_lanes(const Limb* a, const Limb* b, int* out,
+                                std::size_t count, std::size_t width) {
+  for (std::size_t first = 0; first < count; first += BLOCK) {
+    const std::size_t lanes = std::min(BLOCK, count - first);
+    int result[BLOCK] = {};
+    for (std::size_t i = width; i-- > 0;) {
+      const std::size_t offset = i * count + first;
+      const Limb bias = i + 1 == width ? HALF : 0;
+      for (std::size_t j = 0; j < lanes; ++j) {
+        Limb x = a[offset + j] + bias;
+        Limb y = b[offset + j] + bias;
+        x -= x >= BASE ? BASE : 0;
+        y -= y >= BASE ? BASE : 0;
+        int order = (x > y) - (x < y);
+        result[j] = result[j] != 0 ? result[j] : order;
+      }
+    }
+    std::copy(result, result + lanes, out + first);
+  }
+}
+
+void check_shapes(const BigIntegerBatch& a, const BigIntegerBatch& b) {
+  if (a.size() != b.size() || a.width() != b.width()) {
+    throw std::invalid_argument("Batches differ in size or width");
+  }
+}
+
+}  // namespace
+
+BigIntegerBatch::BigIntegerBatch(std::size_t count, std::size_t width)
+    : count_(count), width_(width), limbs_(count * width, 0) {
+  if (width == 0) {
+    throw std::invalid_argument("Batch width must be positive");
+  }
+}
+
+BigIntegerBatch::BigIntegerBatch(std::span<const BigInteger> values,
+                                 std::size_t width)
+    : BigIntegerBatch(values.size(), width) {
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    set(i, values[i]);
+  }
+}
+
+void BigIntegerBatch::set(std::size_t index, const BigInteger& value) {
+  const std::size_t n = value.digits_.size();
+  if (n > width_) {
+    throw std::overflow_error("Value does not fit the batch width");
+  }
+
+  std::vector<Limb> limbs(width_, 0);
+  std::copy_n(value.digits_.begin(), std::min(n, width_), limbs.begin());
+  if (value.is_negative_) {
+    complement(limbs.data(), width_);
+  }
+  if ((limbs.back() >= HALF) != value.is_negative_) {
+    throw std::overflow_error("Value does not fit the batch width");
+  }
+  for (std::size_t i = 0; i < width_; ++i) {
+    row(i)[index] = limbs[i];
+  }
+}
+
+BigInteger BigIntegerBatch::get(std::size_t index) const {
+  BigInteger result;
+  result.digits_.resize(width_);
+  for (std::size_t i = 0; i < width_; ++i) {
+    result.digits_[i] = row(i)[index];
+  }
+  result.is_negative_ = result.digits_.back() >= HALF;
+  if (result.is_negative_) {
+    complement(result.digits_.data(), width_);
+  }
+  result.normalize();
+  return result;
+}
+
+std::vector<BigInteger> BigIntegerBatch::to_vector() const {
+  std::vector<BigInteger> values;
+  values.reserve(count_);
+  for (std::size_t i = 0; i < count_; ++i) {
+    values.push_back(get(i));
+  }
+  return values;
+}
+
+void add_n(BigIntegerBatch& out, const BigIntegerBatch& a,
+           const BigIntegerBatch& b) {
+  check_shapes(a, b);
+  check_shapes(out, a);
+  add_lanes(a.row(0), b.row(0), out.row(0), a.size(), a.width());
+}
+
+void sub_n(BigIntegerBatch& out, const BigIntegerBatch& a,
+           const BigIntegerBatch& b) {
+  check_shapes(a, b);
+  check_shapes(out, a);
+  sub_lanes(a.row(0), b.row(0), out.row(0), a.size(), a.width());
+}
+
+void mul_1(BigIntegerBatch& out, const BigIntegerBatch& a,
+           std::uint32_t factor) {
+  check_shapes(out, a);
+  if (factor >= BASE) {
+    throw std::invalid_argument("Factor must be a single limb");
+  }
+  mul_lanes(a.row(0), factor, out.row(0), a.size(), a.width());
+}
+
+std::vector<int> compare(const BigIntegerBatch& a, const BigIntegerBatch& b) {
+  check_shapes(a, b);
+  std::vector<int> result(a.size());
+  compare_lanes(a.row(0), b.row(0), result.data(), a.size(), a.width());
+  return result;
+}
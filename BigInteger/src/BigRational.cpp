@@ -0,0 +1,175 @@
+#include "BigRational.hpp"
+
+#include <stdexcept>
+
+namespace {
+
+// Limbs in numerator and denominator together; length() is an int.
+std::size_t combined_limbs(const BigInteger& numerator,
+                           const BigInteger& denominator) {
+  return static_cast<std::size_t>(numerator.length()) +
+         static_cast<std::size_t>(denominator.length());
+}
+
+}  // namespace
+
+std::size_t& BigRational::reduction_growth() {
+  static std::size_t growth = 128;
+  return growth;
+}
+
+BigRational::BigRational(long long numerator)
+    : numerator_(numerator), denominator_(1LL) {
+  settle();
+}
+
+BigRational::BigRational(const BigInteger& numerator,
+                         const BigInteger& denominator)
+    : numerator_(numerator), denominator_(denominator) {
+  if (denominator.is_zero()) {
+    throw std::invalid_argument("Denominator cannot be zero");
+  }
+  settle();
+}
+
+const BigInteger& BigRational::numerator() const {
+  reduce();
+  return numerator_;
+}
+
+const BigInteger& BigRational::denominator() const {
+  reduce();
+  return denominator_;
+}
+
+void BigRational::reduce() const {
+  if (!is_reduced_) {
+    BigInteger divisor = gcd(numerator_, denominator_);
+    if (divisor != 1) {
+      numerator_ /= divisor;
+      denominator_ /= divisor;
+    }
+    reduced_limbs_ = combined_limbs(numerator_, denominator_);
+    is_reduced_ = true;
+  }
+}
+
+void BigRational::settle() {
+  if (denominator_.is_negative()) {
+    numerator_ *= -1;
+    denominator_ *= -1;
+  }
+  is_reduced_ = false;
+  if (numerator_.is_zero()) {
+    denominator_ = 1LL;
+    reduced_limbs_ = 2;
+    is_reduced_ = true;
+  } else if (reduction_growth() == 0 ||
+             combined_limbs(numerator_, denominator_) >
+                 reduced_limbs_ + reduction_growth()) {
+    reduce();
+  }
+}
+
+// A shared denominator, common when accumulating prices or weights, costs
+// one addition.
+void BigRational::add(const BigRational& other, bool subtract) {
+  if (denominator_ == other.denominator_) {
+    subtract ? numerator_ -= other.numerator_ : numerator_ += other.numerator_;
+  } else {
+    numerator_ *= other.denominator_;
+    subtract ? numerator_.subtract_product(other.numerator_, denominator_)
+             : numerator_.add_product(other.numerator_, denominator_);
+    denominator_ *= other.denominator_;
+  }
+  settle();
+}
+
+void BigRational::add(const BigInteger& other, bool subtract) {
+  subtract ? numerator_.subtract_product(other, denominator_)
+           : numerator_.add_product(other, denominator_);
+  settle();
+}
+
+BigRational& BigRational::operator+=(const BigRational& other) {
+  add(other, false);
+  return *this;
+}
+
+BigRational& BigRational::operator-=(const BigRational& other) {
+  add(other, true);
+  return *this;
+}
+
+BigRational& BigRational::operator*=(const BigRational& other) {
+  numerator_ *= other.numerator_;
+  denominator_ *= other.denominator_;
+  settle();
+  return *this;
+}
+
+BigRational& BigRational::operator/=(const BigRational& other) {
+  if (other.is_zero()) {
+    throw std::invalid_argument("Cannot divide by zero");
+  }
+  if (this == &other) {
+    return *this = 1;
+  }
+  numerator_ *= other.denominator_;
+  denominator_ *= other.numerator_;
+  settle();
+  return *this;
+}
+
+BigRational& BigRational::operator+=(const BigInteger& other) {
+  add(other, false);
+  return *this;
+}
+
+BigRational& BigRational::operator-=(const BigInteger& other) {
+  add(other, true);
+  return *this;
+}
+
+BigRational& BigRational::operator*=(const BigInteger& other) {
+  numerator_ *= other;
+  settle();
+  return *this;
+}
+
+BigRational& BigRational::operator/=(const BigInteger& other) {
+  if (other.is_zero()) {
+    throw std::invalid_argument("Cannot divide by zero");
+  }
+  denominator_ *= other;
+  settle();
+  return *this;
+}
+
+std::string BigRational::to_string() const {
+  reduce();
+  if (denominator_ == 1) {
+    return numerator_.to_string();
+  }
+  return numerator_.to_string() + "/" + denominator_.to_string();
+}
+
+std::strong_ordering BigRational::operator<=>(const BigRational& other) const {
+  if (is_negative() != other.is_negative()) {
+    return is_negative() ? std::strong_ordering::less
+                         : std::strong_ordering::greater;
+  }
+  reduce();
+  other.reduce();
+  return numerator_ * other.denominator_ <=> other.numerator_ * denominator_;
+}
+
+bool BigRational::operator==(const BigRational& other) const {
+  reduce();
+  other.reduce();
+  return numerator_ == other.numerator_ && denominator_ == other.denominator_;
+}
+
+std::ostream& operator<<(std::ostream& os, const BigRational& value) {
+  return os << value.to_string();
+}
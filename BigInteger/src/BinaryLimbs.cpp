@@ -0,0 +1,204 @@
+#include "BinaryLimbs.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "Multiplication.hpp"
+
+namespace detail {
+
+namespace {
+
+using Limbs = std::vector<Limb>;
+using Words = std::vector<Word>;
+
+void trim(Limbs& x) { x.resize(trimmed_size(x.data(), x.size())); }
+
+void trim(Words& x) {
+  while (!x.empty() && x.back() == 0) {
+    x.pop_back();
+  }
+}
+
+// powers[j] = 2^(64 * 2^j) in base-1e9 limbs.
+std::vector<Limbs> word_powers(std::size_t count) {
+  std::vector<Limbs> powers;
+  powers.push_back({709'551'616, 446'744'073, 18});
+  while (powers.size() < count) {
+    const Limbs& last = powers.back();
+    Limbs square(2 * last.size());
+    multiply(last.data(), last.size(), last.data(), last.size(),
+             square.data());
+    trim(square);
+    powers.push_back(std::move(square));
+  }
+  return powers;
+}
+
+// powers[j] = 1e9^(2^j) in words.
+std::vector<Words> limb_powers(std::size_t count) {
+  std::vector<Words> powers;
+  powers.push_back({BASE});
+  while (powers.size() < count) {
+    const Words& last = powers.back();
+    Words square(2 * last.size());
+    multiply_words(last.data(), last.size(), last.data(), last.size(),
+                   square.data());
+    trim(square);
+    powers.push_back(std::move(square));
+  }
+  return powers;
+}
+
+// Crossover from schoolbook to the NTT for word products.
+constexpr std::size_t WORD_NTT_THRESHOLD = 64;
+
+void multiply_words_schoolbook(const Word* a, std::size_t n, const Word* b,
+                               std::size_t m, Word* out) {
+  std::fill(out, out + n + m, 0);
+  for (std::size_t j = 0; j < m; ++j) {
+    Word carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      DoubleWord current =
+          static_cast<DoubleWord>(a[i]) * b[j] + out[i + j] + carry;
+      out[i + j] = static_cast<Word>(current);
+      carry = static_cast<Word>(current >> 64);
+    }
+    out[n + j] = carry;
+  }
+}
+
+// dst[0, dn) += src[0, sn) with sn <= dn; returns the carry.
+Word add_words(Word* dst, std::size_t dn, const Word* src, std::size_t sn) {
+  Word carry = 0;
+  for (std::size_t i = 0; i < dn && (i < sn || carry != 0); ++i) {
+    DoubleWord current =
+        static_cast<DoubleWord>(dst[i]) + (i < sn ? src[i] : 0) + carry;
+    dst[i] = static_cast<Word>(current);
+    carry = static_cast<Word>(current >> 64);
+  }
+  return carry;
+}
+
+Words limbs_to_words_schoolbook(const Limb* a, std::size_t n) {
+  Words words;
+  for (std::size_t i = n; i-- > 0;) {
+    Word carry = mul_words_1(words.data(), words.size(), BASE, words.data(),
+                             a[i]);
+    if (carry != 0) {
+      words.push_back(carry);
+    }
+  }
+  return words;
+}
+
+Limbs words_to_limbs_schoolbook(const Word* w, std::size_t n) {
+  Words words(w, w + n);
+  trim(words);
+  Limbs limbs;
+  while (!words.empty()) {
+    limbs.push_back(
+        static_cast<Limb>(divrem_words_1(words.data(), words.size(), BASE)));
+    trim(words);
+  }
+  return limbs;
+}
+
+Words limbs_to_words_recursive(const Limb* a, std::size_t n,
+                              const std::vector<Words>& powers,
+                              std::size_t leaf_limbs) {
+  n = trimmed_size(a, n);
+  if (n <= std::max<std::size_t>(leaf_limbs, 1)) {
+    return limbs_to_words_schoolbook(a, n);
+  }
+
+  const std::size_t split = std::bit_floor(n - 1);
+  const Words& power = powers[std::bit_width(split) - 1];
+  Words low = limbs_to_words_recursive(a, split, powers, leaf_limbs);
+  Words high = limbs_to_words_recursive(a + split, n - split, powers,
+                                        leaf_limbs);
+
+  Words result(high.size() + power.size());
+  multiply_words(high.data(), high.size(), power.data(), power.size(),
+                 result.data());
+  add_words(result.data(), result.size(), low.data(), low.size());
+  trim(result);
+  return result;
+}
+
+Limbs words_to_limbs_recursive(const Word* w, std::size_t n,
+                               const std::vector<Limbs>& powers,
+                               std::size_t leaf_words) {
+  while (n > 0 && w[n - 1] == 0) {
+    --n;
+  }
+  if (n <= std::max<std::size_t>(leaf_words, 1)) {
+    return words_to_limbs_schoolbook(w, n);
+  }
+
+  const std::size_t split = std::bit_floor(n - 1);
+  const Limbs& power = powers[std::bit_width(split) - 1];
+  Limbs low = words_to_limbs_recursive(w, split, powers, leaf_words);
+  Limbs high = words_to_limbs_recursive(w + split, n - split, powers,
+                                        leaf_words);
+
+  Limbs result(high.size() + power.size());
+  multiply(high.data(), high.size(), power.data(), power.size(),
+           result.data());
+  add_in_place(result.data(), result.size(), low.data(), low.size());
+  trim(result);
+  return result;
+}
+
+}  // namespace
+
+void multiply_words(const Word* a, std::size_t n, const Word* b,
+                    std::size_t m, Word* out) {
+  if (n < m) {
+    std::swap(a, b);
+    std::swap(n, m);
+  }
+  if (m == 0) {
+    std::fill(out, out + n, 0);
+    return;
+  }
+  if (m < WORD_NTT_THRESHOLD) {
+    multiply_words_schoolbook(a, n, b, m, out);
+    return;
+  }
+  if (2 * (n + m) - 1 <= NTT_MAX_LENGTH) {
+    multiply_words_ntt(a, n, b, m, out);
+    return;
+  }
+
+  // Too long for one transform: split the longer operand in half.
+  const std::size_t half = n / 2;
+  multiply_words(a, half, b, m, out);
+  std::fill(out + half + m, out + n + m, 0);
+  Words high(n - half + m);
+  multiply_words(a + half, n - half, b, m, high.data());
+  add_words(out + half, n - half + m, high.data(), high.size());
+}
+
+std::vector<Word> limbs_to_words(const Limb* a, std::size_t n,
+                                 std::size_t leaf_words) {
+  // A 2^64 word holds a little over two base-1e9 limbs.
+  const std::size_t leaf_limbs = leaf_words * 64 / 30;
+  n = trimmed_size(a, n);
+  std::vector<Words> powers;
+  if (n > std::max<std::size_t>(leaf_limbs, 1)) {
+    powers = limb_powers(std::bit_width(std::bit_floor(n - 1)));
+  }
+  return limbs_to_words_recursive(a, n, powers, leaf_limbs);
+}
+
+std::vector<Limb> words_to_limbs(const Word* w, std::size_t n,
+                                 std::size_t leaf_words) {
+  std::vector<Limbs> powers;
+  if (n > std::max<std::size_t>(leaf_words, 1)) {
+    powers = word_powers(std::bit_width(std::bit_floor(n - 1)));
+  }
+  return words_to_limbs_recursive(w, n, powers, leaf_words);
+}
+
+}  // namespace detail
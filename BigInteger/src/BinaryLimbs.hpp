@@ -0,0 +1,59 @@
+#ifndef BINARY_LIMBS_H
+#define BINARY_LIMBS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "LimbArithmetic.hpp"
+
+// Kernels over little-endian 2^64 words, carried through unsigned __int128,
+// and the radix conversions between them and base-1e9 limbs.
+namespace detail {
+
+using Word = std::uint64_t;
+using DoubleWord = unsigned __int128;
+
+// out[0, n) = a[0, n) * factor + carry_in; returns the carry word. out may
+// alias a.
+inline Word mul_words_1(const Word* a, std::size_t n, Word factor, Word* out,
+                        Word carry_in = 0) {
+  Word carry = carry_in;
+  for (std::size_t i = 0; i < n; ++i) {
+    DoubleWord current = static_cast<DoubleWord>(a[i]) * factor + carry;
+    out[i] = static_cast<Word>(current);
+    carry = static_cast<Word>(current >> 64);
+  }
+  return carry;
+}
+
+// a[0, n) /= divisor in place; returns the remainder.
+inline Word divrem_words_1(Word* a, std::size_t n, Word divisor) {
+  Word remainder = 0;
+  for (std::size_t i = n; i-- > 0;) {
+    DoubleWord current = (static_cast<DoubleWord>(remainder) << 64) | a[i];
+    a[i] = static_cast<Word>(current / divisor);
+    remainder = static_cast<Word>(current % divisor);
+  }
+  return remainder;
+}
+
+// Writes the full n + m word product into out, which must not alias either
+// operand.
+void multiply_words(const Word* a, std::size_t n, const Word* b,
+                    std::size_t m, Word* out);
+
+// Requires 2 * (n + m) - 1 <= NTT_MAX_LENGTH.
+void multiply_words_ntt(const Word* a, std::size_t n, const Word* b,
+                        std::size_t m, Word* out);
+
+// Magnitude conversions; both results are trimmed of leading zeros, and
+// spans shorter than leaf_words words are converted by schoolbook.
+std::vector<Word> limbs_to_words(const Limb* a, std::size_t n,
+                                 std::size_t leaf_words);
+std::vector<Limb> words_to_limbs(const Word* w, std::size_t n,
+                                 std::size_t leaf_words);
+
+}  // namespace detail
+
+#endif
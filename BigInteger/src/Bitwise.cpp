@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "BigInteger.hpp"
+
+namespace {
+
+using Words = std::vector<std::uint64_t>;
+
+// Largest shift applied as a single-limb multiply or divide.
+constexpr std::size_t LIMB_SHIFT = 29;
+
+void negate(Words& words) {
+  bool carry = true;
+  for (std::uint64_t& word : words) {
+    word = ~word;
+    if (carry) {
+      carry = ++word == 0;
+    }
+  }
+}
+
+Words twos_complement(const BigInteger& x, std::size_t size) {
+  Words words = x.to_words();
+  words.resize(size, 0);
+  if (x.is_negative()) {
+    negate(words);
+  }
+  return words;
+}
+
+BigInteger from_twos_complement(Words words) {
+  const bool negative = !words.empty() && words.back() >> 63 != 0;
+  if (negative) {
+    negate(words);
+  }
+  return BigInteger::from_words(words, negative);
+}
+
+long long small_value(const BigInteger& x) {
+  return x.is_negative() ? -static_cast<long long>(x[0]) : x[0];
+}
+
+// Sign-extends both operands to a common word count with room for the sign
+// and combines them word by word.
+template <class Op>
+BigInteger bitwise(const BigInteger& a, const BigInteger& b, Op op) {
+  if (a.length() == 1 && b.length() == 1) {
+    return op(small_value(a), small_value(b));
+  }
+
+  const std::size_t size =
+      (std::max(a.bit_length(), b.bit_length()) + 1 + 63) / 64;
+  Words x = twos_complement(a, size);
+  Words y = twos_complement(b, size);
+  std::transform(x.begin(), x.end(), y.begin(), x.begin(), op);
+  return from_twos_complement(std::move(x));
+}
+
+BigInteger power_of_two(std::size_t bits) {
+  return pow(BigInteger(2LL), BigInteger(static_cast<long long>(bits)));
+}
+
+}  // namespace
+
+BigInteger& BigInteger::operator&=(const BigInteger& other) {
+  return *this = bitwise(*this, other, std::bit_and<>());
+}
+
+BigInteger& BigInteger::operator|=(const BigInteger& other) {
+  return *this = bitwise(*this, other, std::bit_or<>());
+}
+
+BigInteger& BigInteger::operator^=(const BigInteger& other) {
+  return *this = bitwise(*this, other, std::bit_xor<>());
+}
+
+BigInteger& BigInteger::operator<<=(std::size_t bits) {
+  if (bits == 0 || is_zero()) {
+    return *this;
+  }
+  if (bits <= LIMB_SHIFT) {
+    multiply_limb(std::uint32_t{1} << bits, false);
+  } else {
+    *this *= power_of_two(bits);
+  }
+  return *this;
+}
+
+BigInteger& BigInteger::operator>>=(std::size_t bits) {
+  if (bits == 0 || is_zero()) {
+    return *this;
+  }
+  // Every limb holds fewer than 30 bits.
+  if (bits >= 30 * digits_.size()) {
+    return *this = is_negative_ ? -1LL : 0LL;
+  }
+
+  const bool negative = is_negative_;
+  bool inexact;
+  if (bits <= LIMB_SHIFT) {
+    inexact = divide_limb(std::uint32_t{1} << bits, false) != 0;
+  } else {
+    auto [quotient, remainder] = divmod(*this, power_of_two(bits));
+    *this = std::move(quotient);
+    inexact = !remainder.is_zero();
+  }
+  // Truncation rounded a negative quotient up; floor it.
+  if (negative && inexact) {
+    add_limb(1, true);
+  }
+  return *this;
+}
+
+BigInteger operator&(const BigInteger& lhs, const BigInteger& rhs) {
+  return bitwise(lhs, rhs, std::bit_and<>());
+}
+
+BigInteger operator|(const BigInteger& lhs, const BigInteger& rhs) {
+  return bitwise(lhs, rhs, std::bit_or<>());
+}
+
+BigInteger operator^(const BigInteger& lhs, const BigInteger& rhs) {
+  return bitwise(lhs, rhs, std::bit_xor<>());
+}
+
+BigInteger operator~(const BigInteger& value) {
+  BigInteger result = value;
+  result.negate();
+  result.add_limb(1, true);
+  return result;
+}
+
+BigInteger operator<<(const BigInteger& value, std::size_t bits) {
+  BigInteger result = value;
+  result <<= bits;
+  return result;
+}
+
+BigInteger operator>>(const BigInteger& value, std::size_t bits) {
+  BigInteger result = value;
+  result >>= bits;
+  return result;
+}
+
+std::size_t BigInteger::bit_length() const {
+  if (digits_.size() == 1) {
+    return std::bit_width(digits_[0]);
+  }
+  std::vector<std::uint64_t> words = to_words();
+  return 64 * (words.size() - 1) + std::bit_width(words.back());
+}
+
+std::size_t BigInteger::popcount() const {
+  if (digits_.size() == 1) {
+    return std::popcount(digits_[0]);
+  }
+  std::vector<std::uint64_t> words = to_words();
+  return std::accumulate(words.begin(), words.end(), std::size_t{0},
+                         [](std::size_t total, std::uint64_t word) {
+                           return total + std::popcount(word);
+                         });
+}
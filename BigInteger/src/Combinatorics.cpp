@@ -0,0 +1,227 @@
+#include <bit>
+#include <numeric>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "BigInteger.hpp"
+#include "Parallel.hpp"
+
+namespace {
+
+std::vector<std::uint32_t> primes_up_to(std::uint32_t n) {
+  std::vector<bool> composite(n + 1, false);
+  std::vector<std::uint32_t> primes;
+  for (std::uint32_t i = 2; i <= n; ++i) {
+    if (composite[i]) {
+      continue;
+    }
+    primes.push_back(i);
+    for (std::uint64_t j = static_cast<std::uint64_t>(i) * i; j <= n; j += i) {
+      composite[j] = true;
+    }
+  }
+  return primes;
+}
+
+// Collects factors into machine words below 1e9, then multiplies the words
+// pairwise up a balanced tree so that the large products are of equal size.
+class ProductTree {
+ public:
+  void push(std::uint64_t factor, std::uint64_t exponent = 1) {
+    for (; exponent > 0; --exponent) {
+      if (word_ * factor >= 1'000'000'000) {
+        words_.push_back(word_);
+        word_ = 1;
+      }
+      word_ *= factor;
+    }
+  }
+
+  BigInteger product() {
+    words_.push_back(word_);
+    word_ = 1;
+    BigInteger result = multiply(0, words_.size());
+    words_.clear();
+    return result;
+  }
+
+ private:
+  BigInteger multiply(std::size_t from, std::size_t to) const {
+    if (to - from <= 8) {
+      BigInteger result = 1LL;
+      for (std::size_t i = from; i < to; ++i) {
+        result *= static_cast<long long>(words_[i]);
+      }
+      return result;
+    }
+    const std::size_t middle = from + (to - from) / 2;
+    BigInteger low;
+    BigInteger high;
+    detail::parallel_invoke(to - from, {
+        [&] { low = multiply(from, middle); },
+        [&] { high = multiply(middle, to); },
+    });
+    return low * high;
+  }
+
+  std::vector<std::uint64_t> words_;
+  std::uint64_t word_ = 1;
+};
+
+// Exponent of p in n!, by Legendre's formula.
+std::uint64_t factorial_exponent(std::uint64_t n, std::uint64_t p) {
+  std::uint64_t exponent = 0;
+  for (; n > 0; n /= p) {
+    exponent += n / p;
+  }
+  return exponent;
+}
+
+// n! / ((n / 2)!)^2, whose exponent of p is the number of odd n / p^i.
+BigInteger swing(std::uint32_t n, const std::vector<std::uint32_t>& primes) {
+  ProductTree tree;
+  for (std::uint32_t p : primes) {
+    if (p > n) {
+      break;
+    }
+    std::uint64_t exponent = 0;
+    for (std::uint64_t q = n / p; q > 0; q /= p) {
+      exponent += q & 1;
+    }
+    tree.push(p, exponent);
+  }
+  return tree.product();
+}
+
+BigInteger factorial(std::uint32_t n,
+                     const std::vector<std::uint32_t>& primes) {
+  if (n < 20) {
+    std::uint64_t result = 1;
+    for (std::uint32_t i = 2; i <= n; ++i) {
+      result *= i;
+    }
+    return static_cast<long long>(result);
+  }
+  // swing(n) has about n bits, so about n / 30 limbs.
+  BigInteger half;
+  BigInteger swung;
+  detail::parallel_invoke(n / 30, {
+      [&] { half = factorial(n / 2, primes); },
+      [&] { swung = swing(n, primes); },
+  });
+  return half * half * swung;
+}
+
+// (F(n), L(n)) by doubling: F(2k) = F(k) L(k), L(2k) = L(k)^2 - 2(-1)^k,
+// and stepping: F(k + 1) = (F(k) + L(k)) / 2, L(k + 1) = (5F(k) + L(k)) / 2.
+std::pair<BigInteger, BigInteger> fibonacci_lucas(std::size_t n) {
+  BigInteger f = 0LL;
+  BigInteger l = 2LL;
+  bool odd = false;
+  for (int bit = std::bit_width(n) - 1; bit >= 0; --bit) {
+    BigInteger square;
+    detail::parallel_invoke(2 * l.length(), {
+        [&] { f *= l; },
+        [&] { square = l * l; },
+    });
+    l = std::move(square);
+    l += odd ? 2 : -2;
+    odd = false;
+    if ((n >> bit) & 1) {
+      BigInteger next_f = (f + l) / 2;
+      l = (f * 5 + l) / 2;
+      f = std::move(next_f);
+      odd = true;
+    }
+  }
+  return {std::move(f), std::move(l)};
+}
+
+}  // namespace
+
+BigInteger factorial(int n) {
+  if (n < 0) {
+    throw std::invalid_argument("n must be non-negative");
+  }
+  return factorial(static_cast<std::uint32_t>(n), primes_up_to(n));
+}
+
+BigInteger binomial(int n, int k) {
+  if (n < 0) {
+    throw std::invalid_argument("n must be non-negative");
+  }
+  if (k < 0 || k > n) {
+    return 0LL;
+  }
+
+  ProductTree tree;
+  for (std::uint32_t p : primes_up_to(n)) {
+    tree.push(p, factorial_exponent(n, p) - factorial_exponent(k, p) -
+                     factorial_exponent(n - k, p));
+  }
+  return tree.product();
+}
+
+BigInteger NthCatalan(int n) {
+  if (n < 0) {
+    throw std::invalid_argument("n must be non-negative");
+  }
+
+  // C(2n, n) / (n + 1), dividing n + 1 out of the exponents.
+  const std::uint64_t size = 2 * static_cast<std::uint64_t>(n);
+  std::uint64_t divisor = static_cast<std::uint64_t>(n) + 1;
+  ProductTree tree;
+  for (std::uint32_t p : primes_up_to(size)) {
+    std::uint64_t exponent =
+        factorial_exponent(size, p) - 2 * factorial_exponent(n, p);
+    for (; divisor % p == 0; divisor /= p) {
+      --exponent;
+    }
+    tree.push(p, exponent);
+  }
+  return tree.product();
+}
+
+BigInteger NthFibonacci(std::size_t n) {
+  if (n == 0) {
+    return 0LL;
+  }
+
+  // Finish from k = n / 2 with a single product:
+  // F(2k) = F(k) L(k) and F(2k + 1) = F(k + 1) L(k) - (-1)^k.
+  const std::size_t k = n / 2;
+  auto [f, l] = fibonacci_lucas(k);
+  if (n % 2 == 0) {
+    return f * l;
+  }
+  BigInteger result = (f + l) / 2 * l;
+  result += k % 2 == 0 ? -1 : 1;
+  return result;
+}
+
+BigInteger NthLucas(std::size_t n) { return fibonacci_lucas(n).second; }
+
+BigInteger product(std::span<const BigInteger> factors) {
+  if (factors.empty()) {
+    return 1LL;
+  }
+  if (factors.size() == 1) {
+    return factors[0];
+  }
+
+  const std::size_t limbs = std::accumulate(
+      factors.begin(), factors.end(), std::size_t{0},
+      [](std::size_t total, const BigInteger& factor) {
+        return total + factor.length();
+      });
+  const std::size_t middle = factors.size() / 2;
+  BigInteger low;
+  BigInteger high;
+  detail::parallel_invoke(limbs, {
+      [&] { low = product(factors.first(middle)); },
+      [&] { high = product(factors.subspan(middle)); },
+  });
+  return low * high;
+}
@@ -0,0 +1,130 @@
+#include "DecimalText.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+namespace detail {
+
+namespace {
+
+constexpr std::uint64_t ONES = 0x0101'0101'0101'0101;
+
+constexpr bool SWAR = std::endian::native == std::endian::little;
+
+std::uint64_t load8(const char* p) {
+  std::uint64_t chunk;
+  std::memcpy(&chunk, p, sizeof(chunk));
+  return chunk;
+}
+
+bool all_digits(std::uint64_t chunk) {
+  // A byte is a digit iff its high nibble is 3 and adding 6 keeps it so.
+  std::uint64_t high = chunk & (0xF0 * ONES);
+  std::uint64_t carried = ((chunk + 0x06 * ONES) & (0xF0 * ONES)) >> 4;
+  return (high | carried) == 0x33 * ONES;
+}
+
+// Eight digits, first character in the lowest byte, to their value:
+// neighbouring digits, then pairs, then quads are combined by multiplies.
+std::uint32_t parse8(std::uint64_t chunk) {
+  chunk -= 0x30 * ONES;
+  chunk = chunk * 10 + (chunk >> 8);
+  chunk = ((chunk & 0x0000'00FF'0000'00FF) * (100 + (1'000'000ULL << 32)) +
+           ((chunk >> 16) & 0x0000'00FF'0000'00FF) * (1 + (10'000ULL << 32))) >>
+          32;
+  return static_cast<std::uint32_t>(chunk);
+}
+
+Limb parse_short(const char* p, std::size_t count) {
+  Limb value = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    value = value * 10 + static_cast<Limb>(p[i] - '0');
+  }
+  return value;
+}
+
+Limb parse9(const char* p) {
+  if constexpr (SWAR) {
+    return static_cast<Limb>(p[0] - '0') * 100'000'000 + parse8(load8(p + 1));
+  } else {
+    return parse_short(p, 9);
+  }
+}
+
+constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536"
+    "37383940414243444546474849505152535455565758596061626364656667686970717273"
+    "7475767778798081828384858687888990919293949596979899";
+
+void write2(std::uint32_t value, char* out) {
+  std::memcpy(out, DIGIT_PAIRS + 2 * value, 2);
+}
+
+void write4(std::uint32_t value, char* out) {
+  write2(value / 100, out);
+  write2(value % 100, out + 2);
+}
+
+// Nine characters, zero padded.
+void write9(Limb value, char* out) {
+  std::uint32_t low = value % 100'000'000;
+  out[0] = static_cast<char>('0' + value / 100'000'000);
+  write4(low / 10'000, out + 1);
+  write4(low % 10'000, out + 5);
+}
+
+std::size_t digit_count(Limb value) {
+  std::size_t count = 1;
+  while (value >= 10) {
+    value /= 10;
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace
+
+const char* scan_digits(const char* first, const char* last) {
+  if constexpr (SWAR) {
+    while (last - first >= 8 && all_digits(load8(first))) {
+      first += 8;
+    }
+  }
+  while (first != last && *first >= '0' && *first <= '9') {
+    ++first;
+  }
+  return first;
+}
+
+void parse_limbs(const char* digits, std::size_t count, Limb* out) {
+  const std::size_t full = count / 9;
+  const std::size_t head = count % 9;
+  const char* p = digits + count;
+  for (std::size_t i = 0; i < full; ++i) {
+    p -= 9;
+    out[i] = parse9(p);
+  }
+  if (head != 0) {
+    out[full] = parse_short(digits, head);
+  }
+}
+
+std::size_t formatted_length(const Limb* a, std::size_t n) {
+  return digit_count(a[n - 1]) + 9 * (n - 1);
+}
+
+char* format_limbs(const Limb* a, std::size_t n, char* out) {
+  Limb top = a[n - 1];
+  std::size_t top_digits = digit_count(top);
+  char* p = out + top_digits;
+  for (char* q = p; q != out; top /= 10) {
+    *--q = static_cast<char>('0' + top % 10);
+  }
+  for (std::size_t i = n - 1; i-- > 0; p += 9) {
+    write9(a[i], p);
+  }
+  return p;
+}
+
+}  // namespace detail
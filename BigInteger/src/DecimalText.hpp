@@ -0,0 +1,27 @@
+#ifndef DECIMAL_TEXT_H
+#define DECIMAL_TEXT_H
+
+#include <cstddef>
+
+#include "LimbArithmetic.hpp"
+
+// Conversion between decimal text and base-1e9 limbs. Every limb maps onto
+// exactly nine characters, so both directions are linear; digits are
+// handled eight at a time inside a 64-bit register.
+namespace detail {
+
+// End of the run of ASCII digits starting at first.
+const char* scan_digits(const char* first, const char* last);
+
+// Parses count > 0 digits into ceil(count / 9) little-endian limbs.
+void parse_limbs(const char* digits, std::size_t count, Limb* out);
+
+// Characters format_limbs writes for a[0, n), n > 0 and trimmed.
+std::size_t formatted_length(const Limb* a, std::size_t n);
+
+// Writes a[0, n) without leading zeros; returns the end of the output.
+char* format_limbs(const Limb* a, std::size_t n, char* out);
+
+}  // namespace detail
+
+#endif
@@ -0,0 +1,252 @@
+#include "Division.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "BigInteger.hpp"
+#include "Multiplication.hpp"
+
+namespace detail {
+
+namespace {
+
+using Limbs = std::vector<Limb>;
+
+// A threshold of 0 would keep the block padding loop in
+// divide_burnikel_ziegler from terminating, so it acts as 1.
+std::size_t burnikel_ziegler_threshold() {
+  return std::max<std::size_t>(
+      BigInteger::thresholds().burnikel_ziegler_divide, 1);
+}
+
+void trim(Limbs& x) { x.resize(trimmed_size(x.data(), x.size())); }
+
+Limbs slice(const Limbs& x, std::size_t from, std::size_t to) {
+  to = std::min(to, x.size());
+  if (from >= to) {
+    return {};
+  }
+  Limbs result(x.begin() + from, x.begin() + to);
+  trim(result);
+  return result;
+}
+
+// high * BASE^shift + low, where low has at most shift limbs.
+Limbs concatenate(const Limbs& high, std::size_t shift, const Limbs& low) {
+  Limbs result(shift + high.size(), 0);
+  std::copy(low.begin(), low.end(), result.begin());
+  std::copy(high.begin(), high.end(), result.begin() + shift);
+  trim(result);
+  return result;
+}
+
+int compare(const Limbs& x, const Limbs& y) {
+  return detail::compare(x.data(), x.size(), y.data(), y.size());
+}
+
+void add(Limbs& x, const Limbs& y) {
+  x.resize(std::max(x.size(), y.size()) + 1, 0);
+  add_in_place(x.data(), x.size(), y.data(), y.size());
+  trim(x);
+}
+
+// Requires x >= y.
+void subtract(Limbs& x, const Limbs& y) {
+  sub_in_place(x.data(), x.size(), y.data(), y.size());
+  trim(x);
+}
+
+Limbs product(const Limbs& x, const Limbs& y) {
+  Limbs result(x.size() + y.size());
+  multiply(x.data(), x.size(), y.data(), y.size(), result.data());
+  trim(result);
+  return result;
+}
+
+void divide_knuth(const Limb* a, std::size_t n, const Limb* b, std::size_t m,
+                  Limb* q, Limb* r) {
+  if (m == 1) {
+    r[0] = divide_by_limb(a, n, b[0], q);
+    return;
+  }
+
+  // Scale both operands so the divisor's top limb is at least BASE / 2,
+  // which keeps every trial quotient within two of the true limb.
+  const Limb scale = BASE / (b[m - 1] + 1);
+  Limbs u(n + 1);
+  Limbs v(m);
+  u[n] = mul_by_limb(a, n, scale, u.data());
+  mul_by_limb(b, m, scale, v.data());
+
+  const DoubleLimb top = v[m - 1];
+  const DoubleLimb second = v[m - 2];
+
+  for (std::size_t j = n - m + 1; j-- > 0;) {
+    DoubleLimb numerator =
+        static_cast<DoubleLimb>(u[j + m]) * BASE + u[j + m - 1];
+    DoubleLimb q_hat = numerator / top;
+    DoubleLimb r_hat = numerator % top;
+    while (q_hat >= BASE || q_hat * second > r_hat * BASE + u[j + m - 2]) {
+      --q_hat;
+      r_hat += top;
+      if (r_hat >= BASE) {
+        break;
+      }
+    }
+
+    DoubleLimb carry = 0;
+    Limb borrow = 0;
+    for (std::size_t i = 0; i < m; ++i) {
+      DoubleLimb scaled = q_hat * v[i] + carry;
+      carry = scaled / BASE;
+      Limb subtrahend = static_cast<Limb>(scaled % BASE) + borrow;
+      borrow = u[i + j] < subtrahend;
+      u[i + j] = borrow ? u[i + j] + BASE - subtrahend : u[i + j] - subtrahend;
+    }
+
+    // The head limb goes negative exactly when q_hat was one too large.
+    long long head = static_cast<long long>(u[j + m]) -
+                     static_cast<long long>(carry) - borrow;
+    if (head < 0) {
+      --q_hat;
+      head += add_in_place(u.data() + j, m, v.data(), m);
+    }
+    u[j + m] = static_cast<Limb>(head);
+    q[j] = static_cast<Limb>(q_hat);
+  }
+
+  divide_by_limb(u.data(), m, scale, r);
+}
+
+void divide_2n1n(const Limbs& a, const Limbs& b, std::size_t n, Limbs& q,
+                 Limbs& r);
+
+// Divides a (three blocks of h limbs) by b (two blocks of h limbs, top limb
+// normalized), given a < BASE^h * b.
+void divide_3n2n(const Limbs& a, const Limbs& b, std::size_t h, Limbs& q,
+                 Limbs& r) {
+  Limbs a_high = slice(a, h, 3 * h);
+  Limbs b_high = slice(b, h, 2 * h);
+
+  Limbs r_high;
+  if (compare(slice(a, 2 * h, 3 * h), b_high) < 0) {
+    divide_2n1n(a_high, b_high, h, q, r_high);
+  } else {
+    q.assign(h, BASE - 1);
+    r_high = a_high;
+    add(r_high, b_high);
+    subtract(r_high, concatenate(b_high, h, {}));
+  }
+
+  Limbs d = product(q, slice(b, 0, h));
+  r = concatenate(r_high, h, slice(a, 0, h));
+  const Limbs one = {1};
+  while (compare(r, d) < 0) {
+    add(r, b);
+    subtract(q, one);
+  }
+  subtract(r, d);
+}
+
+// Divides a by b (n limbs, top limb normalized), given a < BASE^n * b.
+void divide_2n1n(const Limbs& a, const Limbs& b, std::size_t n, Limbs& q,
+                 Limbs& r) {
+  if (n % 2 != 0 || n < burnikel_ziegler_threshold()) {
+    q.assign(n + 1, 0);
+    r.assign(n, 0);
+    if (compare(a, b) >= 0) {
+      divide_knuth(a.data(), a.size(), b.data(), n, q.data(), r.data());
+    } else {
+      std::copy(a.begin(), a.end(), r.begin());
+    }
+    trim(q);
+    trim(r);
+    return;
+  }
+
+  const std::size_t h = n / 2;
+  Limbs q_high;
+  Limbs r_high;
+  divide_3n2n(slice(a, h, 4 * h), b, h, q_high, r_high);
+
+  Limbs q_low;
+  divide_3n2n(concatenate(r_high, h, slice(a, 0, h)), b, h, q_low, r);
+  q = concatenate(q_high, h, q_low);
+}
+
+void divide_burnikel_ziegler(const Limb* a, std::size_t n, const Limb* b,
+                             std::size_t m, Limb* q, Limb* r) {
+  // Pad the divisor to block = j * 2^k limbs so the recursion halves evenly
+  // down to Knuth-sized pieces.
+  const std::size_t threshold = burnikel_ziegler_threshold();
+  std::size_t levels = 1;
+  while (levels * threshold < m) {
+    levels *= 2;
+  }
+  const std::size_t block = (m + levels - 1) / levels * levels;
+  const std::size_t shift = block - m;
+  const Limb scale = BASE / (b[m - 1] + 1);
+
+  Limbs divisor(block, 0);
+  mul_by_limb(b, m, scale, divisor.data() + shift);
+
+  Limbs dividend(shift + n + 1, 0);
+  dividend[shift + n] = mul_by_limb(a, n, scale, dividend.data() + shift);
+  trim(dividend);
+
+  std::size_t blocks = (dividend.size() + block - 1) / block;
+  Limbs top = slice(dividend, (blocks - 1) * block, blocks * block);
+  if (compare(top, divisor) >= 0) {
+    ++blocks;
+  }
+  blocks = std::max<std::size_t>(blocks, 2);
+
+  Limbs quotient((blocks - 1) * block, 0);
+  Limbs remainder = slice(dividend, (blocks - 1) * block, blocks * block);
+  for (std::size_t i = blocks - 1; i-- > 0;) {
+    Limbs z = concatenate(remainder, block,
+                          slice(dividend, i * block, (i + 1) * block));
+    Limbs q_block;
+    divide_2n1n(z, divisor, block, q_block, remainder);
+    std::copy(q_block.begin(), q_block.end(), quotient.begin() + i * block);
+  }
+
+  std::fill(q, q + n - m + 1, 0);
+  std::copy_n(quotient.begin(), std::min(quotient.size(), n - m + 1), q);
+  std::fill(r, r + m, 0);
+  Limbs unscaled = slice(remainder, shift, remainder.size());
+  divide_by_limb(unscaled.data(), unscaled.size(), scale, unscaled.data());
+  std::copy(unscaled.begin(), unscaled.end(), r);
+}
+
+}  // namespace
+
+Limb divide_by_limb(const Limb* a, std::size_t n, Limb divisor, Limb* q) {
+  DoubleLimb remainder = 0;
+  for (std::size_t i = n; i-- > 0;) {
+    DoubleLimb current = remainder * BASE + a[i];
+    q[i] = static_cast<Limb>(current / divisor);
+    remainder = current % divisor;
+  }
+  return static_cast<Limb>(remainder);
+}
+
+Limb remainder_by_limb(const Limb* a, std::size_t n, Limb divisor) {
+  DoubleLimb remainder = 0;
+  for (std::size_t i = n; i-- > 0;) {
+    remainder = (remainder * BASE + a[i]) % divisor;
+  }
+  return static_cast<Limb>(remainder);
+}
+
+void divide(const Limb* a, std::size_t n, const Limb* b, std::size_t m,
+            Limb* q, Limb* r) {
+  const std::size_t threshold = burnikel_ziegler_threshold();
+  if (m < threshold || n - m < threshold) {
+    divide_knuth(a, n, b, m, q, r);
+  } else {
+    divide_burnikel_ziegler(a, n, b, m, q, r);
+  }
+}
+
+}  // namespace detail
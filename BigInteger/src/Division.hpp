@@ -0,0 +1,26 @@
+#ifndef DIVISION_H
+#define DIVISION_H
+
+#include <cstddef>
+
+#include "LimbArithmetic.hpp"
+
+namespace detail {
+
+// Divides a[0, n) by b[0, m) with n >= m and b[m - 1] != 0. Writes n - m + 1
+// quotient limbs into q and m remainder limbs into r; neither may alias the
+// operands. Large divisors go through Burnikel-Ziegler recursion as picked
+// by BigInteger::thresholds(), the rest through Knuth's Algorithm D.
+void divide(const Limb* a, std::size_t n, const Limb* b, std::size_t m,
+            Limb* q, Limb* r);
+
+// Divides a[0, n) by a single limb 0 < divisor < BASE into q[0, n) and
+// returns the remainder. q may alias a.
+Limb divide_by_limb(const Limb* a, std::size_t n, Limb divisor, Limb* q);
+
+// Remainder of a[0, n) modulo a single limb 0 < divisor < BASE.
+Limb remainder_by_limb(const Limb* a, std::size_t n, Limb divisor);
+
+}  // namespace detail
+
+#endif
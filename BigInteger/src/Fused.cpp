@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "BigInteger.hpp"
+#include "Division.hpp"
+#include "LimbArithmetic.hpp"
+#include "Multiplication.hpp"
+
+namespace {
+
+// Reused product and quotient storage; the kernels below never nest.
+std::vector<detail::Limb>& product_scratch() {
+  thread_local std::vector<detail::Limb> scratch;
+  return scratch;
+}
+
+std::vector<detail::Limb>& quotient_scratch() {
+  thread_local std::vector<detail::Limb> scratch;
+  return scratch;
+}
+
+// Carries 64-bit column sums into base-1e9 limbs.
+std::vector<detail::Limb> carry_columns(
+    const std::vector<std::uint64_t>& columns) {
+  std::vector<detail::Limb> limbs;
+  limbs.reserve(columns.size() + 2);
+  std::uint64_t carry = 0;
+  for (std::uint64_t column : columns) {
+    carry += column;
+    limbs.push_back(static_cast<detail::Limb>(carry % detail::BASE));
+    carry /= detail::BASE;
+  }
+  for (; carry != 0; carry /= detail::BASE) {
+    limbs.push_back(static_cast<detail::Limb>(carry % detail::BASE));
+  }
+  return limbs;
+}
+
+}  // namespace
+
+void BigInteger::add_limbs(const std::uint32_t* limbs, std::size_t count,
+                           bool negative) {
+  count = detail::trimmed_size(limbs, count);
+  if (count == 0) {
+    return;
+  }
+
+  const std::size_t size = digits_.size();
+  if (is_negative_ == negative) {
+    digits_.resize(std::max(size, count) + 1, 0);
+    detail::add_in_place(digits_.data(), digits_.size(), limbs, count);
+  } else if (detail::compare(digits_.data(), size, limbs, count) >= 0) {
+    detail::sub_in_place(digits_.data(), size, limbs, count);
+  } else {
+    digits_.resize(count, 0);
+    detail::sub_from_in_place(digits_.data(), limbs, count);
+    is_negative_ = negative;
+  }
+  normalize();
+}
+
+void BigInteger::accumulate_product(const BigInteger& a, const BigInteger& b,
+                                    bool negative) {
+  if (a.is_zero() || b.is_zero()) {
+    return;
+  }
+  negative = negative != (a.is_negative_ != b.is_negative_);
+  const bool a_longer = a.digits_.size() >= b.digits_.size();
+  const LimbVector& longer = a_longer ? a.digits_ : b.digits_;
+  const LimbVector& shorter = a_longer ? b.digits_ : a.digits_;
+  const std::size_t n = longer.size();
+  const std::size_t m = shorter.size();
+
+  if (m < thresholds().karatsuba_multiply && &a != this && &b != this &&
+      (is_zero() || is_negative_ == negative)) {
+    const std::size_t size = std::max(digits_.size(), n + m) + 1;
+    digits_.resize(size, 0);
+    for (std::size_t i = 0; i < m; ++i) {
+      const detail::Limb carry = detail::addmul_by_limb(
+          digits_.data() + i, longer.data(), n, shorter[i]);
+      detail::add_in_place(digits_.data() + i + n, size - i - n, &carry, 1);
+    }
+    is_negative_ = negative;
+    normalize();
+    return;
+  }
+
+  std::vector<detail::Limb>& product = product_scratch();
+  product.resize(n + m);
+  detail::multiply(longer.data(), n, shorter.data(), m, product.data());
+  add_limbs(product.data(), product.size(), negative);
+}
+
+BigInteger& BigInteger::add_product(const BigInteger& a,
+                                    const BigInteger& b) {
+  accumulate_product(a, b, false);
+  return *this;
+}
+
+BigInteger& BigInteger::subtract_product(const BigInteger& a,
+                                         const BigInteger& b) {
+  accumulate_product(a, b, true);
+  return *this;
+}
+
+BigInteger multiply_remainder(const BigInteger& a, const BigInteger& b,
+                              const BigInteger& m) {
+  if (m.is_zero()) {
+    throw std::invalid_argument("Division by zero");
+  }
+
+  std::vector<detail::Limb>& product = product_scratch();
+  product.resize(a.digits_.size() + b.digits_.size());
+  detail::multiply(a.digits_.data(), a.digits_.size(), b.digits_.data(),
+                   b.digits_.size(), product.data());
+  const std::size_t n = detail::trimmed_size(product.data(), product.size());
+  const std::size_t k = m.digits_.size();
+
+  BigInteger result;
+  if (detail::compare(product.data(), n, m.digits_.data(), k) < 0) {
+    result.add_limbs(product.data(), n, false);
+  } else {
+    std::vector<detail::Limb>& quotient = quotient_scratch();
+    quotient.resize(n - k + 1);
+    result.digits_.resize(k);
+    detail::divide(product.data(), n, m.digits_.data(), k, quotient.data(),
+                   result.digits_.data());
+  }
+  result.is_negative_ = a.is_negative_ != b.is_negative_;
+  result.normalize();
+  return result;
+}
+
+BigInteger sum(std::span<const BigInteger> terms) {
+  std::vector<std::uint64_t> columns[2];
+  for (const BigInteger& term : terms) {
+    std::vector<std::uint64_t>& column = columns[term.is_negative_];
+    if (column.size() < term.digits_.size()) {
+      column.resize(term.digits_.size(), 0);
+    }
+    for (std::size_t i = 0; i < term.digits_.size(); ++i) {
+      column[i] += term.digits_[i];
+    }
+  }
+
+  BigInteger result;
+  for (bool negative : {false, true}) {
+    const std::vector<detail::Limb> limbs = carry_columns(columns[negative]);
+    result.add_limbs(limbs.data(), limbs.size(), negative);
+  }
+  return result;
+}
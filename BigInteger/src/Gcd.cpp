@@ -0,0 +1,219 @@
+#include <cstdint>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+
+#include "BigInteger.hpp"
+
+namespace {
+
+constexpr long long BASE = 1'000'000'000;
+
+// A stretch of the remainder sequence as the linear map
+// (a, b) -> (t00 a + t01 b, t10 a + t11 b).
+struct Transform {
+  BigInteger t00 = 1LL;
+  BigInteger t01 = 0LL;
+  BigInteger t10 = 0LL;
+  BigInteger t11 = 1LL;
+};
+
+// The same map with machine-word entries, as found by Lehmer's algorithm.
+struct Cosequence {
+  long long a = 1;
+  long long b = 0;
+  long long c = 0;
+  long long d = 1;
+};
+
+// Pairs carried through the same steps as the pair being reduced.
+using Followers = std::initializer_list<std::pair<BigInteger*, BigInteger*>>;
+
+void apply(const Transform& t, BigInteger& x, BigInteger& y) {
+  BigInteger next_x = t.t00 * x + t.t01 * y;
+  y = t.t10 * x + t.t11 * y;
+  x = std::move(next_x);
+}
+
+void apply(const Cosequence& s, BigInteger& x, BigInteger& y) {
+  BigInteger next_x = x * s.a + y * s.b;
+  y = x * s.c + y * s.d;
+  x = std::move(next_x);
+}
+
+void apply_all(const Transform& t, Followers followers) {
+  for (auto [x, y] : followers) {
+    apply(t, *x, *y);
+  }
+}
+
+Transform compose(const Transform& later, const Transform& earlier) {
+  Transform t = earlier;
+  apply(later, t.t00, t.t10);
+  apply(later, t.t01, t.t11);
+  return t;
+}
+
+// Knuth's Algorithm L: runs Euclid on the leading two limbs of a and the
+// aligned limbs of b for as long as the quotient is the same at both ends
+// of the truncation interval, so every step is one the full pair takes.
+Cosequence lehmer_cosequence(const BigInteger& a, const BigInteger& b) {
+  const std::size_t n = a.length();
+  auto limb = [](const BigInteger& x, std::size_t i) -> long long {
+    return i < static_cast<std::size_t>(x.length()) ? x[i] : 0;
+  };
+  long long x = limb(a, n - 1) * BASE + limb(a, n - 2);
+  long long y = limb(b, n - 1) * BASE + limb(b, n - 2);
+
+  Cosequence s;
+  while (y + s.c > 0 && y + s.d > 0 && x + s.a >= 0 && x + s.b >= 0) {
+    long long q = (x + s.a) / (y + s.c);
+    if (q != (x + s.b) / (y + s.d)) {
+      break;
+    }
+    s = {s.c, s.d, s.a - q * s.c, s.b - q * s.d};
+    x = std::exchange(y, x - q * y);
+  }
+  return s;
+}
+
+// One or more steps of the remainder sequence of a > b > 0.
+void euclid_step(BigInteger& a, BigInteger& b, Followers followers) {
+  Cosequence s = a.length() > 2 ? lehmer_cosequence(a, b) : Cosequence{};
+  if (s.b != 0) {
+    apply(s, a, b);
+    for (auto [x, y] : followers) {
+      apply(s, *x, *y);
+    }
+    return;
+  }
+
+  auto [q, r] = divmod(a, b);
+  a = std::exchange(b, std::move(r));
+  for (auto [x, y] : followers) {
+    BigInteger next_y = *x - q * *y;
+    *x = std::exchange(*y, std::move(next_y));
+  }
+}
+
+Transform half_gcd(BigInteger& a, BigInteger& b);
+
+// Reduces a > b >= 0 by the transform half_gcd finds for their limbs from
+// split up. Truncation can steer the last quotients wrong, but a result
+// that still satisfies a > b >= 0 proves every quotient right; otherwise
+// the pair is left alone.
+Transform reduce_by_top(BigInteger& a, BigInteger& b, std::size_t split) {
+  BigInteger high_a = a.limb_slice(split, a.length());
+  BigInteger high_b = b.limb_slice(split, b.length());
+  if (high_b.is_zero() || high_b >= high_a) {
+    return {};
+  }
+
+  Transform t = half_gcd(high_a, high_b);
+  BigInteger next_a = a;
+  BigInteger next_b = b;
+  apply(t, next_a, next_b);
+  if (next_b.is_negative() || next_b >= next_a) {
+    return {};
+  }
+  a = std::move(next_a);
+  b = std::move(next_b);
+  return t;
+}
+
+// Reduces a > b >= 0 in place along their remainder sequence until b has
+// at most half of a's limbs, returning the transform applied. Two
+// recursions on top halves do the bulk of the work in O(M(n) log n).
+Transform half_gcd(BigInteger& a, BigInteger& b) {
+  const std::size_t n = a.length();
+  const std::size_t target = n / 2 + 1;
+  Transform t;
+  if (static_cast<std::size_t>(b.length()) <= target) {
+    return t;
+  }
+
+  if (n >= BigInteger::thresholds().half_gcd) {
+    t = reduce_by_top(a, b, n / 2);
+    const std::size_t size = a.length();
+    if (static_cast<std::size_t>(b.length()) > target) {
+      t = compose(reduce_by_top(a, b, 2 * target - size), t);
+    }
+  }
+  while (static_cast<std::size_t>(b.length()) > target) {
+    euclid_step(a, b, {{&t.t00, &t.t10}, {&t.t01, &t.t11}});
+  }
+  return t;
+}
+
+// Runs a >= b >= 0 down to (gcd, 0), carrying the followers along.
+void euclid(BigInteger& a, BigInteger& b, Followers followers) {
+  while (!b.is_zero()) {
+    const std::size_t n = a.length();
+    if (n >= BigInteger::thresholds().half_gcd &&
+        static_cast<std::size_t>(b.length()) > n / 2 + 1) {
+      apply_all(half_gcd(a, b), followers);
+    } else if (n <= 2 && followers.size() == 0) {
+      auto value = [](const BigInteger& x) {
+        return static_cast<std::uint64_t>(x[0]) +
+               (x.length() > 1 ? static_cast<std::uint64_t>(x[1]) * BASE : 0);
+      };
+      std::uint64_t x = value(a);
+      std::uint64_t y = value(b);
+      while (y != 0) {
+        x = std::exchange(y, x % y);
+      }
+      a = static_cast<long long>(x);
+      b = 0LL;
+    } else {
+      euclid_step(a, b, followers);
+    }
+  }
+}
+
+}  // namespace
+
+BigInteger gcd(const BigInteger& a, const BigInteger& b) {
+  BigInteger x = a.abs();
+  BigInteger y = b.abs();
+  if (x < y) {
+    std::swap(x, y);
+  }
+  euclid(x, y, {});
+  return x;
+}
+
+BigInteger lcm(const BigInteger& a, const BigInteger& b) {
+  if (a.is_zero() || b.is_zero()) {
+    return 0LL;
+  }
+  return a.abs() / gcd(a, b) * b.abs();
+}
+
+std::tuple<BigInteger, BigInteger, BigInteger> extended_gcd(
+    const BigInteger& a, const BigInteger& b) {
+  BigInteger x = a.abs();
+  BigInteger y = b.abs();
+  const bool swapped = x < y;
+  if (swapped) {
+    std::swap(x, y);
+  }
+
+  // Only the cofactor of x is tracked; the other follows by one division.
+  BigInteger g = x;
+  BigInteger r = y;
+  BigInteger u = 1LL;
+  BigInteger v = 0LL;
+  euclid(g, r, {{&u, &v}});
+  BigInteger w = y.is_zero() ? BigInteger(0LL) : (g - u * x) / y;
+
+  if (swapped) {
+    std::swap(u, w);
+  }
+  if (a.is_negative()) {
+    u.negate();
+  }
+  if (b.is_negative()) {
+    w.negate();
+  }
+  return {std::move(g), std::move(u), std::move(w)};
+}
@@ -0,0 +1,110 @@
+#ifndef LIMB_ARITHMETIC_H
+#define LIMB_ARITHMETIC_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Kernels over raw little-endian base-1e9 limb spans. Callers guarantee the
+// sizes; nothing here is bounds-checked.
+namespace detail {
+
+using Limb = std::uint32_t;
+using DoubleLimb = std::uint64_t;
+inline constexpr Limb BASE = 1'000'000'000;
+
+inline std::size_t trimmed_size(const Limb* a, std::size_t n) {
+  while (n > 0 && a[n - 1] == 0) {
+    --n;
+  }
+  return n;
+}
+
+inline int compare(const Limb* a, std::size_t n, const Limb* b, std::size_t m) {
+  n = trimmed_size(a, n);
+  m = trimmed_size(b, m);
+  if (n != m) {
+    return n < m ? -1 : 1;
+  }
+  for (std::size_t i = n; i-- > 0;) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+// dst[0, dn) += src[0, sn) with sn <= dn; returns the carry out of dst.
+inline Limb add_in_place(Limb* dst, std::size_t dn, const Limb* src,
+                         std::size_t sn) {
+  Limb carry = 0;
+  std::size_t i = 0;
+  for (; i < sn; ++i) {
+    Limb current = dst[i] + src[i] + carry;
+    carry = current >= BASE;
+    dst[i] = carry ? current - BASE : current;
+  }
+  for (; carry && i < dn; ++i) {
+    Limb current = dst[i] + carry;
+    carry = current >= BASE;
+    dst[i] = carry ? current - BASE : current;
+  }
+  return carry;
+}
+
+// dst[0, dn) -= src[0, sn) with sn <= dn; returns the borrow out of dst.
+inline Limb sub_in_place(Limb* dst, std::size_t dn, const Limb* src,
+                         std::size_t sn) {
+  Limb borrow = 0;
+  std::size_t i = 0;
+  for (; i < sn; ++i) {
+    Limb subtrahend = src[i] + borrow;
+    borrow = dst[i] < subtrahend;
+    dst[i] = borrow ? dst[i] + BASE - subtrahend : dst[i] - subtrahend;
+  }
+  for (; borrow && i < dn; ++i) {
+    borrow = dst[i] == 0;
+    dst[i] = borrow ? BASE - 1 : dst[i] - 1;
+  }
+  return borrow;
+}
+
+// dst[0, n) = src[0, n) - dst[0, n), given src >= dst; both spans are n
+// limbs long.
+inline void sub_from_in_place(Limb* dst, const Limb* src, std::size_t n) {
+  Limb borrow = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    Limb subtrahend = dst[i] + borrow;
+    borrow = src[i] < subtrahend;
+    dst[i] = borrow ? src[i] + BASE - subtrahend : src[i] - subtrahend;
+  }
+}
+
+// out[0, n) = a[0, n) * factor with 0 <= factor < BASE; returns the carry
+// limb. out may alias a.
+inline Limb mul_by_limb(const Limb* a, std::size_t n, Limb factor, Limb* out) {
+  DoubleLimb carry = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    DoubleLimb current = static_cast<DoubleLimb>(a[i]) * factor + carry;
+    out[i] = static_cast<Limb>(current % BASE);
+    carry = current / BASE;
+  }
+  return static_cast<Limb>(carry);
+}
+
+// dst[0, n) += a[0, n) * factor with 0 <= factor < BASE; returns the carry
+// limb.
+inline Limb addmul_by_limb(Limb* dst, const Limb* a, std::size_t n,
+                           Limb factor) {
+  DoubleLimb carry = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    DoubleLimb current =
+        static_cast<DoubleLimb>(a[i]) * factor + dst[i] + carry;
+    dst[i] = static_cast<Limb>(current % BASE);
+    carry = current / BASE;
+  }
+  return static_cast<Limb>(carry);
+}
+
+}  // namespace detail
+
+#endif
@@ -0,0 +1,243 @@
+#include "Modular.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "LimbArithmetic.hpp"
+#include "Multiplication.hpp"
+
+namespace {
+
+void check_modulus(const BigInteger& modulus) {
+  if (modulus <= 0) {
+    throw std::invalid_argument("Modulus must be positive");
+  }
+}
+
+BigInteger remainder(const BigInteger& x, const BigInteger& modulus) {
+  BigInteger r = x % modulus;
+  if (r.is_negative()) {
+    r += modulus;
+  }
+  return r;
+}
+
+// Left-to-right sliding-window exponentiation over the binary digits of a
+// non-negative exponent, with one and multiply taken from a context.
+template <class Multiply>
+BigInteger window_pow(const BigInteger& base, const BigInteger& exponent,
+                      BigInteger one, Multiply multiply) {
+  const std::vector<std::uint64_t> words = exponent.to_words();
+  if (words.empty()) {
+    return one;
+  }
+  const std::size_t bits = 64 * (words.size() - 1) +
+                           std::bit_width(words.back());
+  auto bit = [&](std::size_t i) { return (words[i / 64] >> (i % 64)) & 1; };
+
+  const std::size_t width = bits > 671   ? 6
+                            : bits > 239 ? 5
+                            : bits > 79  ? 4
+                            : bits > 23  ? 3
+                                         : 1;
+  // odd[i] = base^(2i + 1).
+  std::vector<BigInteger> odd(std::size_t{1} << (width - 1));
+  odd[0] = base;
+  if (odd.size() > 1) {
+    const BigInteger square = multiply(base, base);
+    for (std::size_t i = 1; i < odd.size(); ++i) {
+      odd[i] = multiply(odd[i - 1], square);
+    }
+  }
+
+  BigInteger result = std::move(one);
+  bool started = false;
+  for (std::size_t i = bits; i-- > 0;) {
+    if (!bit(i)) {
+      result = multiply(result, result);
+      continue;
+    }
+    std::size_t low = i + 1 >= width ? i + 1 - width : 0;
+    while (!bit(low)) {
+      ++low;
+    }
+    std::size_t window = 0;
+    for (std::size_t j = i + 1; j-- > low;) {
+      window = window << 1 | bit(j);
+      if (started) {
+        result = multiply(result, result);
+      }
+    }
+    result = started ? multiply(result, odd[window >> 1]) : odd[window >> 1];
+    started = true;
+    i = low;
+  }
+  return result;
+}
+
+}  // namespace
+
+BarrettContext::BarrettContext(const BigInteger& modulus)
+    : modulus_(modulus), limbs_(modulus.digits_.size()) {
+  check_modulus(modulus);
+  BigInteger power = 1LL;
+  power.shift_limbs(2 * limbs_);
+  reciprocal_ = power / modulus_;
+}
+
+BigInteger BarrettContext::reduce(const BigInteger& x) const {
+  if (x.digits_.size() > 2 * limbs_) {
+    return remainder(x, modulus_);
+  }
+
+  // The quotient estimate from the top limbs falls short by at most two.
+  BigInteger quotient = x.limb_slice(limbs_ - 1, x.digits_.size()) *
+                        reciprocal_;
+  quotient = quotient.limb_slice(limbs_ + 1, quotient.digits_.size());
+  BigInteger r = x.abs() - quotient * modulus_;
+  while (r >= modulus_) {
+    r -= modulus_;
+  }
+  if (x.is_negative() && !r.is_zero()) {
+    r = modulus_ - r;
+  }
+  return r;
+}
+
+BigInteger BarrettContext::multiply(const BigInteger& a,
+                                    const BigInteger& b) const {
+  return reduce(a * b);
+}
+
+BigInteger BarrettContext::pow(const BigInteger& base,
+                               const BigInteger& exponent) const {
+  if (exponent.is_negative()) {
+    return pow(invmod(base, modulus_), exponent.abs());
+  }
+  return window_pow(reduce(base), exponent, reduce(1LL),
+                    [this](const BigInteger& a, const BigInteger& b) {
+                      return multiply(a, b);
+                    });
+}
+
+MontgomeryContext::MontgomeryContext(const BigInteger& modulus)
+    : modulus_(modulus), limbs_(modulus.digits_.size()) {
+  check_modulus(modulus);
+  const std::uint32_t low = modulus.digits_[0];
+  if (low % 2 == 0 || low % 5 == 0) {
+    throw std::invalid_argument("Montgomery modulus must be coprime to 10");
+  }
+
+  // Newton's iteration x <- x (2 - m x) doubles the number of correct
+  // decimal digits of m^-1 mod BASE, starting from one digit.
+  std::uint64_t x = 1;
+  while (low * x % 10 != 1) {
+    x += 2;
+  }
+  for (int i = 0; i < 4; ++i) {
+    std::uint64_t product = low * x % BigInteger::BASE;
+    x = x * (2 + BigInteger::BASE - product) % BigInteger::BASE;
+  }
+  inverse_ = static_cast<std::uint32_t>((BigInteger::BASE - x) %
+                                        BigInteger::BASE);
+
+  BigInteger power = 1LL;
+  power.shift_limbs(limbs_);
+  one_ = power % modulus_;
+  power.shift_limbs(limbs_);
+  r_squared_ = power % modulus_;
+}
+
+BigInteger MontgomeryContext::reduce(LimbVector& t) const {
+  const std::size_t k = limbs_;
+  const detail::Limb* m = modulus_.digits_.data();
+  for (std::size_t i = 0; i < k; ++i) {
+    auto factor = static_cast<detail::Limb>(
+        static_cast<detail::DoubleLimb>(t[i]) * inverse_ % BigInteger::BASE);
+    detail::Limb carry = detail::addmul_by_limb(t.data() + i, m, k, factor);
+    detail::add_in_place(t.data() + i + k, 2 * k + 1 - i - k, &carry, 1);
+  }
+
+  BigInteger result;
+  result.digits_.assign(k + 1, 0);
+  std::copy(t.begin() + k, t.end(), result.digits_.begin());
+  result.normalize();
+  if (result >= modulus_) {
+    result -= modulus_;
+  }
+  return result;
+}
+
+const BigInteger& MontgomeryContext::in_range(const BigInteger& x,
+                                              BigInteger& storage) const {
+  if (!x.is_negative() && x < modulus_) {
+    return x;
+  }
+  storage = remainder(x, modulus_);
+  return storage;
+}
+
+BigInteger MontgomeryContext::to_montgomery(const BigInteger& x) const {
+  return multiply(remainder(x, modulus_), r_squared_);
+}
+
+BigInteger MontgomeryContext::from_montgomery(const BigInteger& x) const {
+  BigInteger storage;
+  const BigInteger& reduced = in_range(x, storage);
+  LimbVector t(2 * limbs_ + 1);
+  std::copy(reduced.digits_.begin(), reduced.digits_.end(), t.begin());
+  return reduce(t);
+}
+
+BigInteger MontgomeryContext::multiply(const BigInteger& a,
+                                       const BigInteger& b) const {
+  BigInteger a_storage;
+  BigInteger b_storage;
+  const BigInteger& a_reduced = in_range(a, a_storage);
+  const BigInteger& b_reduced = in_range(b, b_storage);
+  LimbVector t(2 * limbs_ + 1);
+  detail::multiply(a_reduced.digits_.data(), a_reduced.digits_.size(),
+                   b_reduced.digits_.data(), b_reduced.digits_.size(),
+                   t.data());
+  return reduce(t);
+}
+
+BigInteger MontgomeryContext::pow(const BigInteger& base,
+                                  const BigInteger& exponent) const {
+  if (exponent.is_negative()) {
+    return pow(invmod(base, modulus_), exponent.abs());
+  }
+  BigInteger result =
+      window_pow(to_montgomery(base), exponent, one_,
+                 [this](const BigInteger& a, const BigInteger& b) {
+                   return multiply(a, b);
+                 });
+  return from_montgomery(result);
+}
+
+BigInteger mulmod(const BigInteger& a, const BigInteger& b,
+                  const BigInteger& modulus) {
+  check_modulus(modulus);
+  return remainder(multiply_remainder(a, b, modulus), modulus);
+}
+
+BigInteger powmod(const BigInteger& base, const BigInteger& exponent,
+                  const BigInteger& modulus) {
+  check_modulus(modulus);
+  if (modulus % 2 != 0 && modulus % 5 != 0) {
+    return MontgomeryContext(modulus).pow(base, exponent);
+  }
+  return BarrettContext(modulus).pow(base, exponent);
+}
+
+BigInteger invmod(const BigInteger& a, const BigInteger& modulus) {
+  check_modulus(modulus);
+  auto [g, x, y] = extended_gcd(remainder(a, modulus), modulus);
+  if (g != 1) {
+    throw std::invalid_argument("Value is not invertible modulo the modulus");
+  }
+  return remainder(x, modulus);
+}
@@ -0,0 +1,279 @@
+#include "Multiplication.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "BigInteger.hpp"
+#include "Parallel.hpp"
+
+namespace detail {
+
+namespace {
+
+struct SignedLimbs {
+  std::vector<Limb> magnitude;
+  bool negative = false;
+};
+
+SignedLimbs slice(const Limb* a, std::size_t n, std::size_t from,
+                  std::size_t to) {
+  SignedLimbs result;
+  to = std::min(to, n);
+  if (from < to) {
+    const Limb* first = a + from;
+    result.magnitude.assign(first, first + trimmed_size(first, to - from));
+  }
+  return result;
+}
+
+void trim(SignedLimbs& x) {
+  x.magnitude.resize(trimmed_size(x.magnitude.data(), x.magnitude.size()));
+  if (x.magnitude.empty()) {
+    x.negative = false;
+  }
+}
+
+void add_signed(SignedLimbs& x, const SignedLimbs& y, bool subtract = false) {
+  bool y_negative = y.negative != subtract;
+  std::vector<Limb>& lhs = x.magnitude;
+  const std::vector<Limb>& rhs = y.magnitude;
+
+  if (x.negative == y_negative) {
+    lhs.resize(std::max(lhs.size(), rhs.size()) + 1, 0);
+    add_in_place(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+  } else if (compare(lhs.data(), lhs.size(), rhs.data(), rhs.size()) >= 0) {
+    sub_in_place(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+  } else {
+    std::vector<Limb> difference = rhs;
+    sub_in_place(difference.data(), difference.size(), lhs.data(), lhs.size());
+    lhs = std::move(difference);
+    x.negative = y_negative;
+  }
+  trim(x);
+}
+
+void sub_signed(SignedLimbs& x, const SignedLimbs& y) { add_signed(x, y, true); }
+
+void mul_small(SignedLimbs& x, Limb factor) {
+  Limb carry = mul_by_limb(x.magnitude.data(), x.magnitude.size(), factor,
+                           x.magnitude.data());
+  if (carry) {
+    x.magnitude.push_back(carry);
+  }
+}
+
+void div_exact_small(SignedLimbs& x, Limb divisor) {
+  DoubleLimb remainder = 0;
+  for (std::size_t i = x.magnitude.size(); i-- > 0;) {
+    DoubleLimb current = remainder * BASE + x.magnitude[i];
+    x.magnitude[i] = static_cast<Limb>(current / divisor);
+    remainder = current % divisor;
+  }
+  trim(x);
+}
+
+SignedLimbs multiply_signed(const SignedLimbs& x, const SignedLimbs& y) {
+  SignedLimbs result;
+  if (x.magnitude.empty() || y.magnitude.empty()) {
+    return result;
+  }
+  result.magnitude.resize(x.magnitude.size() + y.magnitude.size());
+  multiply(x.magnitude.data(), x.magnitude.size(), y.magnitude.data(),
+           y.magnitude.size(), result.magnitude.data());
+  result.negative = x.negative != y.negative;
+  trim(result);
+  return result;
+}
+
+// Values of x0 + x1 t + x2 t^2 at t = 1, -1, -2.
+void evaluate(const SignedLimbs& x0, const SignedLimbs& x1,
+              const SignedLimbs& x2, SignedLimbs& at_one,
+              SignedLimbs& at_minus_one, SignedLimbs& at_minus_two) {
+  SignedLimbs even = x0;
+  add_signed(even, x2);
+
+  at_one = even;
+  add_signed(at_one, x1);
+
+  at_minus_one = even;
+  sub_signed(at_minus_one, x1);
+
+  at_minus_two = at_minus_one;
+  add_signed(at_minus_two, x2);
+  mul_small(at_minus_two, 2);
+  sub_signed(at_minus_two, x0);
+}
+
+void add_at(Limb* out, std::size_t size, std::size_t offset,
+            const SignedLimbs& x) {
+  add_in_place(out + offset, size - offset, x.magnitude.data(),
+               x.magnitude.size());
+}
+
+// Requires n >= m > 2 * ceil(n / 3).
+void multiply_toom3(const Limb* a, std::size_t n, const Limb* b, std::size_t m,
+                    Limb* out) {
+  const std::size_t k = (n + 2) / 3;
+
+  SignedLimbs a1, am1, am2, b1, bm1, bm2;
+  evaluate(slice(a, n, 0, k), slice(a, n, k, 2 * k), slice(a, n, 2 * k, n),
+           a1, am1, am2);
+  evaluate(slice(b, m, 0, k), slice(b, m, k, 2 * k), slice(b, m, 2 * k, m),
+           b1, bm1, bm2);
+
+  std::fill(out + 2 * k, out + 4 * k, 0);
+  SignedLimbs r1, rm1, r3;
+  parallel_invoke(n + m, {
+      [&] { multiply(a, k, b, k, out); },
+      [&] {
+        multiply(a + 2 * k, n - 2 * k, b + 2 * k, m - 2 * k, out + 4 * k);
+      },
+      [&] { r1 = multiply_signed(a1, b1); },
+      [&] { rm1 = multiply_signed(am1, bm1); },
+      [&] { r3 = multiply_signed(am2, bm2); },
+  });
+
+  SignedLimbs r0 = slice(out, n + m, 0, 2 * k);
+  SignedLimbs r4 = slice(out, n + m, 4 * k, n + m);
+
+  sub_signed(r3, r1);
+  div_exact_small(r3, 3);
+
+  sub_signed(r1, rm1);
+  div_exact_small(r1, 2);
+
+  SignedLimbs r2 = std::move(rm1);
+  sub_signed(r2, r0);
+
+  SignedLimbs twice_r4 = r4;
+  mul_small(twice_r4, 2);
+  SignedLimbs half = r2;
+  sub_signed(half, r3);
+  div_exact_small(half, 2);
+  r3 = std::move(half);
+  add_signed(r3, twice_r4);
+
+  add_signed(r2, r1);
+  sub_signed(r2, r4);
+
+  sub_signed(r1, r3);
+
+  add_at(out, n + m, k, r1);
+  add_at(out, n + m, 2 * k, r2);
+  add_at(out, n + m, 3 * k, r3);
+}
+
+// Requires n >= m > ceil(n / 2).
+void multiply_karatsuba(const Limb* a, std::size_t n, const Limb* b,
+                        std::size_t m, Limb* out) {
+  const std::size_t h = (n + 1) / 2;
+
+  std::vector<Limb> a_sum(a, a + h);
+  a_sum.push_back(0);
+  add_in_place(a_sum.data(), a_sum.size(), a + h, n - h);
+
+  std::vector<Limb> b_sum(b, b + h);
+  b_sum.push_back(0);
+  add_in_place(b_sum.data(), b_sum.size(), b + h, m - h);
+
+  std::vector<Limb> middle(2 * h + 2);
+  parallel_invoke(n + m, {
+      [&] { multiply(a, h, b, h, out); },
+      [&] { multiply(a + h, n - h, b + h, m - h, out + 2 * h); },
+      [&] {
+        multiply(a_sum.data(), a_sum.size(), b_sum.data(), b_sum.size(),
+                 middle.data());
+      },
+  });
+  sub_in_place(middle.data(), middle.size(), out, 2 * h);
+  sub_in_place(middle.data(), middle.size(), out + 2 * h, n + m - 2 * h);
+
+  add_in_place(out + h, n + m - h, middle.data(),
+               trimmed_size(middle.data(), middle.size()));
+}
+
+// Splits the longer operand into chunks the size of the shorter one so each
+// partial product is balanced. Chunks that may run concurrently get their
+// own buffers.
+void multiply_unbalanced(const Limb* a, std::size_t n, const Limb* b,
+                         std::size_t m, Limb* out) {
+  std::fill(out, out + n + m, 0);
+  if (n + m < BigInteger::thresholds().parallel_multiply ||
+      thread_count() == 1) {
+    std::vector<Limb> partial(2 * m);
+    for (std::size_t offset = 0; offset < n; offset += m) {
+      std::size_t length = std::min(m, n - offset);
+      multiply(a + offset, length, b, m, partial.data());
+      add_in_place(out + offset, n + m - offset, partial.data(), length + m);
+    }
+    return;
+  }
+
+  const std::size_t chunks = (n + m - 1) / m;
+  std::vector<std::vector<Limb>> partials(chunks);
+  std::vector<std::function<void()>> tasks;
+  for (std::size_t i = 0; i < chunks; ++i) {
+    tasks.push_back([=, &partials] {
+      std::size_t length = std::min(m, n - i * m);
+      partials[i].resize(length + m);
+      multiply(a + i * m, length, b, m, partials[i].data());
+    });
+  }
+  parallel_invoke(n + m, tasks);
+  for (std::size_t i = 0; i < chunks; ++i) {
+    add_in_place(out + i * m, n + m - i * m, partials[i].data(),
+                 partials[i].size());
+  }
+}
+
+}  // namespace
+
+void multiply_schoolbook(const Limb* a, std::size_t n, const Limb* b,
+                         std::size_t m, Limb* out) {
+  std::fill(out, out + n + m, 0);
+  for (std::size_t i = 0; i < n; ++i) {
+    DoubleLimb factor = a[i];
+    if (factor == 0) {
+      continue;
+    }
+    DoubleLimb carry = 0;
+    Limb* row = out + i;
+    for (std::size_t j = 0; j < m; ++j) {
+      DoubleLimb current = row[j] + factor * b[j] + carry;
+      row[j] = static_cast<Limb>(current % BASE);
+      carry = current / BASE;
+    }
+    row[m] = static_cast<Limb>(carry);
+  }
+}
+
+void multiply(const Limb* a, std::size_t n, const Limb* b, std::size_t m,
+              Limb* out) {
+  if (n < m) {
+    std::swap(a, b);
+    std::swap(n, m);
+  }
+  if (m == 0) {
+    std::fill(out, out + n, 0);
+    return;
+  }
+
+  // Below four limbs Karatsuba's middle product is no smaller than its
+  // parent and the recursion would not terminate.
+  const BigInteger::Thresholds& thresholds = BigInteger::thresholds();
+  if (m < std::max<std::size_t>(thresholds.karatsuba_multiply, 4)) {
+    multiply_schoolbook(a, n, b, m, out);
+  } else if (m >= thresholds.ntt_multiply && n + m - 1 <= NTT_MAX_LENGTH) {
+    multiply_ntt(a, n, b, m, out);
+  } else if (2 * m <= n + 1) {
+    multiply_unbalanced(a, n, b, m, out);
+  } else if (m < thresholds.toom3_multiply || m <= 2 * ((n + 2) / 3)) {
+    multiply_karatsuba(a, n, b, m, out);
+  } else {
+    multiply_toom3(a, n, b, m, out);
+  }
+}
+
+}  // namespace detail
@@ -0,0 +1,28 @@
+#ifndef MULTIPLICATION_H
+#define MULTIPLICATION_H
+
+#include <cstddef>
+
+#include "LimbArithmetic.hpp"
+
+namespace detail {
+
+// Writes the full n + m limb product into out, which must not alias either
+// operand. Operands may carry leading zero limbs. The algorithm is picked
+// from BigInteger::thresholds() by operand size.
+void multiply(const Limb* a, std::size_t n, const Limb* b, std::size_t m,
+              Limb* out);
+
+void multiply_schoolbook(const Limb* a, std::size_t n, const Limb* b,
+                         std::size_t m, Limb* out);
+
+// Longest convolution the three-prime NTT can represent exactly.
+inline constexpr std::size_t NTT_MAX_LENGTH = std::size_t{1} << 23;
+
+// Requires n + m - 1 <= NTT_MAX_LENGTH.
+void multiply_ntt(const Limb* a, std::size_t n, const Limb* b, std::size_t m,
+                  Limb* out);
+
+}  // namespace detail
+
+#endif
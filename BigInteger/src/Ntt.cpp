@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include "BinaryLimbs.hpp"
+#include "Multiplication.hpp"
+#include "Parallel.hpp"
+
+namespace detail {
+
+namespace {
+
+// Three NTT-friendly primes, each with primitive root 3. Their product
+// (~7.9e25) bounds every convolution coefficient of base-1e9 limbs, or of
+// 32-bit word halves, up to NTT_MAX_LENGTH terms, so the CRT recombination
+// is exact.
+constexpr std::uint32_t PRIMES[3] = {998'244'353, 167'772'161, 469'762'049};
+constexpr std::uint32_t PRIMITIVE_ROOT = 3;
+
+std::uint32_t pow_mod(std::uint64_t base, std::uint64_t exponent,
+                      std::uint32_t mod) {
+  std::uint64_t result = 1;
+  base %= mod;
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result = result * base % mod;
+    }
+    base = base * base % mod;
+    exponent >>= 1;
+  }
+  return static_cast<std::uint32_t>(result);
+}
+
+void transform(std::vector<std::uint32_t>& a, std::uint32_t mod, bool invert) {
+  const std::size_t n = a.size();
+
+  for (std::size_t i = 1, j = 0; i < n; ++i) {
+    std::size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      std::swap(a[i], a[j]);
+    }
+  }
+
+  std::vector<std::uint32_t> roots(n / 2);
+  for (std::size_t length = 2; length <= n; length <<= 1) {
+    std::uint32_t root = pow_mod(PRIMITIVE_ROOT, (mod - 1) / length, mod);
+    if (invert) {
+      root = pow_mod(root, mod - 2, mod);
+    }
+
+    const std::size_t half = length / 2;
+    roots[0] = 1;
+    for (std::size_t k = 1; k < half; ++k) {
+      roots[k] = static_cast<std::uint64_t>(roots[k - 1]) * root % mod;
+    }
+
+    for (std::size_t i = 0; i < n; i += length) {
+      std::uint32_t* lo = a.data() + i;
+      std::uint32_t* hi = lo + half;
+      for (std::size_t k = 0; k < half; ++k) {
+        std::uint32_t u = lo[k];
+        std::uint32_t v = static_cast<std::uint64_t>(hi[k]) * roots[k] % mod;
+        lo[k] = u + v >= mod ? u + v - mod : u + v;
+        hi[k] = u >= v ? u - v : u + mod - v;
+      }
+    }
+  }
+
+  if (invert) {
+    std::uint64_t inverse_n = pow_mod(n, mod - 2, mod);
+    for (std::uint32_t& x : a) {
+      x = static_cast<std::uint32_t>(x * inverse_n % mod);
+    }
+  }
+}
+
+std::vector<std::uint32_t> convolve(const std::uint32_t* a, std::size_t n,
+                                    const std::uint32_t* b, std::size_t m,
+                                    std::size_t length, std::uint32_t mod) {
+  auto forward = [&](const std::uint32_t* x, std::size_t size) {
+    std::vector<std::uint32_t> fx(length, 0);
+    for (std::size_t i = 0; i < size; ++i) {
+      fx[i] = static_cast<std::uint32_t>(x[i] % mod);
+    }
+    transform(fx, mod, false);
+    return fx;
+  };
+
+  std::vector<std::uint32_t> fa;
+  if (a == b && n == m) {
+    fa = forward(a, n);
+    for (std::uint32_t& x : fa) {
+      x = static_cast<std::uint32_t>(static_cast<std::uint64_t>(x) * x % mod);
+    }
+  } else {
+    std::vector<std::uint32_t> fb;
+    parallel_invoke(n + m, {
+        [&] { fa = forward(a, n); },
+        [&] { fb = forward(b, m); },
+    });
+    for (std::size_t i = 0; i < length; ++i) {
+      fa[i] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(fa[i]) *
+                                         fb[i] % mod);
+    }
+  }
+
+  transform(fa, mod, true);
+  return fa;
+}
+
+// Hands every exact coefficient of the convolution of a and b, lowest
+// first, to emit as an unsigned __int128.
+template <class Emit>
+void convolve_exact(const std::uint32_t* a, std::size_t n,
+                    const std::uint32_t* b, std::size_t m, Emit emit) {
+  const std::size_t terms = n + m - 1;
+  const std::size_t length = std::bit_ceil(terms);
+
+  std::vector<std::uint32_t> residues[3];
+  auto residue = [&](int p) {
+    return [&, p] { residues[p] = convolve(a, n, b, m, length, PRIMES[p]); };
+  };
+  parallel_invoke(n + m, {residue(0), residue(1), residue(2)});
+
+  const std::uint64_t p0 = PRIMES[0];
+  const std::uint64_t p1 = PRIMES[1];
+  const std::uint64_t p2 = PRIMES[2];
+  const std::uint64_t p0_inv_mod_p1 = pow_mod(p0, p1 - 2, p1);
+  const std::uint64_t p0p1 = p0 * p1;
+  const std::uint64_t p0p1_inv_mod_p2 = pow_mod(p0p1 % p2, p2 - 2, p2);
+
+  for (std::size_t i = 0; i < terms; ++i) {
+    std::uint64_t r0 = residues[0][i];
+    std::uint64_t r1 = residues[1][i];
+    std::uint64_t r2 = residues[2][i];
+
+    std::uint64_t k1 = (r1 + p1 - r0 % p1) % p1 * p0_inv_mod_p1 % p1;
+    std::uint64_t x01 = r0 + p0 * k1;
+    std::uint64_t k2 = (r2 + p2 - x01 % p2) % p2 * p0p1_inv_mod_p2 % p2;
+
+    emit(x01 + static_cast<unsigned __int128>(p0p1) * k2);
+  }
+}
+
+std::vector<std::uint32_t> split_words(const Word* w, std::size_t n) {
+  std::vector<std::uint32_t> halves(2 * n);
+  for (std::size_t i = 0; i < n; ++i) {
+    halves[2 * i] = static_cast<std::uint32_t>(w[i]);
+    halves[2 * i + 1] = static_cast<std::uint32_t>(w[i] >> 32);
+  }
+  return halves;
+}
+
+}  // namespace
+
+void multiply_ntt(const Limb* a, std::size_t n, const Limb* b, std::size_t m,
+                  Limb* out) {
+  unsigned __int128 carry = 0;
+  std::size_t i = 0;
+  convolve_exact(a, n, b, m, [&](unsigned __int128 coefficient) {
+    unsigned __int128 current = coefficient + carry;
+    out[i++] = static_cast<Limb>(current % BASE);
+    carry = current / BASE;
+  });
+  out[i] = static_cast<Limb>(carry);
+}
+
+void multiply_words_ntt(const Word* a, std::size_t n, const Word* b,
+                        std::size_t m, Word* out) {
+  // Convolve 32-bit halves so every coefficient stays below the CRT bound.
+  const bool square = a == b && n == m;
+  std::vector<std::uint32_t> fa = split_words(a, n);
+  std::vector<std::uint32_t> fb = square ? std::vector<std::uint32_t>()
+                                         : split_words(b, m);
+  std::vector<std::uint32_t> halves(2 * (n + m));
+
+  unsigned __int128 carry = 0;
+  std::size_t i = 0;
+  convolve_exact(fa.data(), fa.size(), square ? fa.data() : fb.data(),
+                 2 * m, [&](unsigned __int128 coefficient) {
+                   unsigned __int128 current = coefficient + carry;
+                   halves[i++] = static_cast<std::uint32_t>(current);
+                   carry = current >> 32;
+                 });
+  for (; i < halves.size(); ++i, carry >>= 32) {
+    halves[i] = static_cast<std::uint32_t>(carry);
+  }
+
+  for (std::size_t k = 0; k < n + m; ++k) {
+    out[k] = static_cast<Word>(halves[2 * k + 1]) << 32 | halves[2 * k];
+  }
+}
+
+}  // namespace detail
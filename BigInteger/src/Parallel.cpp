@@ -0,0 +1,177 @@
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "BigInteger.hpp"
+
+namespace detail {
+
+namespace {
+
+class ThreadPool {
+ public:
+  explicit ThreadPool(std::size_t workers) {
+    for (std::size_t i = 0; i < workers; ++i) {
+      workers_.emplace_back([this] { work(); });
+    }
+  }
+
+  // Drains the queue before the workers exit.
+  ~ThreadPool() {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    ready_.notify_all();
+    for (std::thread& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void push(std::function<void()> task) {
+    {
+      std::lock_guard lock(mutex_);
+      queue_.push_back(std::move(task));
+    }
+    ready_.notify_one();
+  }
+
+  // Runs one queued task on the calling thread, if there is any.
+  bool run_one() {
+    std::function<void()> task;
+    {
+      std::lock_guard lock(mutex_);
+      if (queue_.empty()) {
+        return false;
+      }
+      task = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    task();
+    return true;
+  }
+
+ private:
+  void work() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock lock(mutex_);
+        ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (queue_.empty()) {
+          return;
+        }
+        task = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<std::function<void()>> queue_;
+  std::vector<std::thread> workers_;
+  bool stopping_ = false;
+};
+
+// Completion state of one parallel_invoke call.
+struct Batch {
+  std::mutex mutex;
+  std::condition_variable finished;
+  std::size_t remaining = 0;
+  std::exception_ptr error;
+
+  void run(const std::function<void()>& task) {
+    std::exception_ptr caught;
+    try {
+      task();
+    } catch (...) {
+      caught = std::current_exception();
+    }
+    std::lock_guard lock(mutex);
+    if (caught && !error) {
+      error = caught;
+    }
+    if (--remaining == 0) {
+      finished.notify_all();
+    }
+  }
+
+  bool done() {
+    std::lock_guard lock(mutex);
+    return remaining == 0;
+  }
+};
+
+std::mutex pool_mutex;
+std::size_t threads = 1;
+std::shared_ptr<ThreadPool> pool;
+
+std::shared_ptr<ThreadPool> current_pool() {
+  std::lock_guard lock(pool_mutex);
+  return pool;
+}
+
+}  // namespace
+
+void set_thread_count(std::size_t count) {
+  count = std::max<std::size_t>(count, 1);
+  std::shared_ptr<ThreadPool> replaced;
+  {
+    std::lock_guard lock(pool_mutex);
+    if (count == threads) {
+      return;
+    }
+    threads = count;
+    replaced = std::move(pool);
+    if (count > 1) {
+      pool = std::make_shared<ThreadPool>(count - 1);
+    }
+  }
+}
+
+std::size_t thread_count() {
+  std::lock_guard lock(pool_mutex);
+  return threads;
+}
+
+void parallel_invoke(std::size_t work_limbs,
+                     const std::vector<std::function<void()>>& tasks) {
+  std::shared_ptr<ThreadPool> workers;
+  if (tasks.size() > 1 &&
+      work_limbs >= BigInteger::thresholds().parallel_multiply) {
+    workers = current_pool();
+  }
+  if (!workers) {
+    for (const std::function<void()>& task : tasks) {
+      task();
+    }
+    return;
+  }
+
+  Batch batch;
+  batch.remaining = tasks.size();
+  for (std::size_t i = 1; i < tasks.size(); ++i) {
+    workers->push([&batch, &task = tasks[i]] { batch.run(task); });
+  }
+  batch.run(tasks[0]);
+
+  while (!batch.done()) {
+    if (!workers->run_one()) {
+      std::unique_lock lock(batch.mutex);
+      batch.finished.wait(lock, [&batch] { return batch.remaining == 0; });
+    }
+  }
+  if (batch.error) {
+    std::rethrow_exception(batch.error);
+  }
+}
+
+}  // namespace detail
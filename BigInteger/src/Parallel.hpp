@@ -0,0 +1,25 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// A process-wide pool of worker threads for splitting large products.
+namespace detail {
+
+// Total threads, the caller included; 1 disables the pool.
+void set_thread_count(std::size_t count);
+std::size_t thread_count();
+
+// Runs the tasks and returns once all have finished, rethrowing the first
+// exception. They run concurrently when work_limbs reaches
+// BigInteger::thresholds().parallel_multiply and the pool is enabled, and
+// in order otherwise. The calling thread works through queued tasks while
+// it waits, so nested calls cannot exhaust the pool.
+void parallel_invoke(std::size_t work_limbs,
+                     const std::vector<std::function<void()>>& tasks);
+
+}  // namespace detail
+
+#endif
@@ -0,0 +1,172 @@
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "BigInteger.hpp"
+
+namespace {
+
+std::uint64_t isqrt64(std::uint64_t value) {
+  auto root = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(value)));
+  while (root * root > value) {
+    --root;
+  }
+  while ((root + 1) * (root + 1) <= value) {
+    ++root;
+  }
+  return root;
+}
+
+template <unsigned Modulus>
+constexpr std::array<bool, Modulus> quadratic_residues() {
+  std::array<bool, Modulus> residues{};
+  for (unsigned i = 0; i < Modulus; ++i) {
+    residues[i * i % Modulus] = true;
+  }
+  return residues;
+}
+
+constexpr auto RESIDUES_64 = quadratic_residues<64>();
+constexpr auto RESIDUES_63 = quadratic_residues<63>();
+constexpr auto RESIDUES_65 = quadratic_residues<65>();
+constexpr auto RESIDUES_11 = quadratic_residues<11>();
+
+BigInteger power(const BigInteger& base, unsigned exponent) {
+  return pow(base, BigInteger(static_cast<long long>(exponent)));
+}
+
+}  // namespace
+
+std::pair<BigInteger, BigInteger> BigInteger::sqrt_rem_normalized(
+    const BigInteger& n) {
+  const std::size_t size = n.digits_.size();
+  if (size == 2) {
+    std::uint64_t value =
+        static_cast<std::uint64_t>(n.digits_[1]) * BASE + n.digits_[0];
+    std::uint64_t root = isqrt64(value);
+    return {BigInteger(static_cast<long long>(root)),
+            BigInteger(static_cast<long long>(value - root * root))};
+  }
+
+  // n = high * B^2 + a1 * B + a0 with B = BASE^low, where high keeps at
+  // least as many root limbs as B, so its root s' satisfies s' >= B / 2.
+  const std::size_t low = size / 4;
+  auto [root, remainder] = sqrt_rem_normalized(n.limb_slice(2 * low, size));
+
+  remainder.shift_limbs(low);
+  remainder += n.limb_slice(low, 2 * low);
+  auto [q, u] = divmod(remainder, root + root);
+
+  root.shift_limbs(low);
+  root += q;
+  u.shift_limbs(low);
+  u += n.limb_slice(0, low);
+  u -= q * q;
+  if (u.is_negative()) {
+    u += root;
+    u += root;
+    u -= 1;
+    root -= 1;
+  }
+  return {std::move(root), std::move(u)};
+}
+
+std::pair<BigInteger, BigInteger> isqrt_rem(const BigInteger& n) {
+  if (n.is_negative()) {
+    throw std::invalid_argument(
+        "Square root of negative number is not supported.");
+  }
+
+  if (n.digits_.size() == 1) {
+    std::uint64_t root = isqrt64(n.digits_[0]);
+    return {BigInteger(static_cast<long long>(root)),
+            BigInteger(static_cast<long long>(n.digits_[0] - root * root))};
+  }
+
+  // Scale by 4^shift until the limb count is even and the top limb is at
+  // least BASE / 4; the root of the scaled value is then 2^shift times
+  // too large.
+  BigInteger scaled = n;
+  unsigned shift = 0;
+  while (scaled.digits_.size() % 2 != 0 ||
+         scaled.digits_.back() < BigInteger::BASE / 4) {
+    scaled.multiply_limb(4, false);
+    ++shift;
+  }
+
+  BigInteger root = BigInteger::sqrt_rem_normalized(scaled).first;
+  for (; shift > 0; --shift) {
+    root.divide_limb(2, false);
+  }
+  BigInteger remainder = n - root * root;
+  return {std::move(root), std::move(remainder)};
+}
+
+BigInteger sqrt(const BigInteger& n) { return isqrt_rem(n).first; }
+
+BigInteger nth_root(const BigInteger& n, unsigned k) {
+  if (k == 0) {
+    throw std::invalid_argument("Zeroth root is undefined");
+  }
+  if (n.is_negative()) {
+    if (k % 2 == 0) {
+      throw std::invalid_argument("Even root of negative number");
+    }
+    BigInteger root = nth_root(n.abs(), k);
+    root.negate();
+    return root;
+  }
+  if (k == 1 || n <= 1) {
+    return n;
+  }
+  if (k == 2) {
+    return sqrt(n);
+  }
+
+  // Overestimate the root from the leading limbs as mantissa * BASE^limbs,
+  // with the mantissa between BASE and BASE^2.
+  const std::size_t size = n.digits_.size();
+  const double log_base = std::log(static_cast<double>(BigInteger::BASE));
+  double top = n.digits_[size - 1];
+  if (size > 1) {
+    top += n.digits_[size - 2] / static_cast<double>(BigInteger::BASE);
+  }
+  const double log_root = (std::log(top) + (size - 1) * log_base) / k;
+  const double whole = std::floor(log_root / log_base) - 1;
+  const std::size_t limbs = whole > 0 ? static_cast<std::size_t>(whole) : 0;
+  const double mantissa =
+      std::exp(log_root - limbs * log_base) * (1 + 1e-6) + 1;
+
+  BigInteger root(static_cast<long long>(mantissa));
+  root.shift_limbs(limbs);
+  while (power(root, k) <= n) {
+    root *= 2;
+  }
+
+  // From above, Newton's step decreases monotonically onto the floor root.
+  while (true) {
+    BigInteger next = (root * (k - 1) + n / power(root, k - 1)) / k;
+    if (next >= root) {
+      return root;
+    }
+    root = std::move(next);
+  }
+}
+
+bool is_perfect_square(const BigInteger& n) {
+  if (n.is_negative()) {
+    return false;
+  }
+  // BASE is a multiple of 64, so the low limb fixes the residue mod 64.
+  if (!RESIDUES_64[n.digits_[0] % 64]) {
+    return false;
+  }
+  const long long residue = n % (63LL * 65 * 11);
+  if (!RESIDUES_63[residue % 63] || !RESIDUES_65[residue % 65] ||
+      !RESIDUES_11[residue % 11]) {
+    return false;
+  }
+  return isqrt_rem(n).second.is_zero();
+}
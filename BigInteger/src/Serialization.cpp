@@ -0,0 +1,310 @@
+#include "Serialization.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include "LimbArithmetic.hpp"
+
+namespace {
+
+using detail::BASE;
+using detail::Limb;
+
+constexpr char MAGIC[] = {'B', 'G', 'I', 'N'};
+constexpr std::uint8_t VERSION = 1;
+constexpr std::uint8_t BIG_ENDIAN_LIMBS = 1;
+constexpr bool HOST_BIG_ENDIAN = std::endian::native == std::endian::big;
+
+// Magic, version, flags and a ten-byte count.
+constexpr std::size_t MAX_HEADER_SIZE = sizeof(MAGIC) + 2 + 10;
+
+[[noreturn]] void malformed() {
+  throw std::invalid_argument("Malformed serialized BigInteger data");
+}
+
+Limb swap_bytes(Limb x) {
+  return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+}
+
+std::size_t varint_size(std::uint64_t x) {
+  return std::max<std::size_t>(1, (std::bit_width(x) + 6) / 7);
+}
+
+std::byte* put_varint(std::uint64_t x, std::byte* out) {
+  while (x >= 0x80) {
+    *out++ = static_cast<std::byte>(x | 0x80);
+    x >>= 7;
+  }
+  *out++ = static_cast<std::byte>(x);
+  return out;
+}
+
+std::byte* put_header(std::size_t count, std::byte* out) {
+  out = std::copy_n(reinterpret_cast<const std::byte*>(MAGIC), sizeof(MAGIC),
+                    out);
+  *out++ = std::byte{VERSION};
+  *out++ = std::byte{HOST_BIG_ENDIAN ? BIG_ENDIAN_LIMBS : std::uint8_t{0}};
+  return put_varint(count, out);
+}
+
+std::uint64_t record_header(const BigIntegerView& value) {
+  return 2 * static_cast<std::uint64_t>(value.size()) + value.is_negative();
+}
+
+std::size_t record_size(const BigIntegerView& value) {
+  return varint_size(record_header(value)) + sizeof(Limb) * value.size();
+}
+
+std::byte* put_record(const BigIntegerView& value, std::byte* out) {
+  out = put_varint(record_header(value), out);
+  return std::copy_n(value.data(), sizeof(Limb) * value.size(), out);
+}
+
+class Reader {
+ public:
+  explicit Reader(std::span<const std::byte> data) : data_(data) {}
+
+  bool done() const { return position_ == data_.size(); }
+
+  const std::byte* take(std::size_t count) {
+    if (count > data_.size() - position_) {
+      malformed();
+    }
+    const std::byte* first = data_.data() + position_;
+    position_ += count;
+    return first;
+  }
+
+  std::uint64_t varint() {
+    std::uint64_t x = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+      const auto byte = std::to_integer<std::uint64_t>(*take(1));
+      // The tenth byte holds only bit 63 and must end the varint.
+      if (shift == 63 && byte > 1) {
+        malformed();
+      }
+      x |= (byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        return x;
+      }
+    }
+    malformed();
+  }
+
+  std::size_t remaining() const { return data_.size() - position_; }
+
+ private:
+  std::span<const std::byte> data_;
+  std::size_t position_ = 0;
+};
+
+}  // namespace
+
+BigIntegerView::BigIntegerView(const BigInteger& value)
+    : limbs_(reinterpret_cast<const std::byte*>(value.digits_.data())),
+      size_(value.is_zero() ? 0 : value.digits_.size()),
+      is_negative_(value.is_negative_),
+      swap_bytes_(false) {}
+
+BigIntegerView::BigIntegerView(const std::byte* limbs, std::size_t size,
+                               bool negative, bool big_endian)
+    : limbs_(limbs),
+      size_(size),
+      is_negative_(negative && size != 0),
+      swap_bytes_(big_endian != HOST_BIG_ENDIAN) {}
+
+std::uint32_t BigIntegerView::operator[](std::size_t index) const {
+  Limb limb;
+  std::memcpy(&limb, limbs_ + sizeof(Limb) * index, sizeof(Limb));
+  return swap_bytes_ ? swap_bytes(limb) : limb;
+}
+
+BigIntegerView::operator BigInteger() const {
+  BigInteger result;
+  if (size_ == 0) {
+    return result;
+  }
+  result.digits_.resize(size_);
+  Limb* digits = result.digits_.data();
+  if (swap_bytes_) {
+    for (std::size_t i = 0; i < size_; ++i) {
+      digits[i] = (*this)[i];
+    }
+  } else {
+    std::memcpy(digits, limbs_, sizeof(Limb) * size_);
+  }
+  if (digits[size_ - 1] == 0 ||
+      std::any_of(digits, digits + size_, [](Limb d) { return d >= BASE; })) {
+    throw std::invalid_argument("Limbs do not form a canonical BigInteger");
+  }
+  result.is_negative_ = is_negative_;
+  return result;
+}
+
+std::strong_ordering operator<=>(const BigIntegerView& lhs,
+                                 const BigIntegerView& rhs) {
+  if (lhs.is_negative_ != rhs.is_negative_) {
+    return lhs.is_negative_ ? std::strong_ordering::less
+                            : std::strong_ordering::greater;
+  }
+  int magnitude = 0;
+  if (lhs.size_ != rhs.size_) {
+    magnitude = lhs.size_ < rhs.size_ ? -1 : 1;
+  } else {
+    for (std::size_t i = lhs.size_; i-- > 0 && magnitude == 0;) {
+      magnitude = (lhs[i] > rhs[i]) - (lhs[i] < rhs[i]);
+    }
+  }
+  return (lhs.is_negative_ ? -magnitude : magnitude) <=> 0;
+}
+
+bool operator==(const BigIntegerView& lhs, const BigIntegerView& rhs) {
+  return (lhs <=> rhs) == 0;
+}
+
+std::vector<std::byte> serialize(std::span<const BigInteger> values) {
+  std::size_t size = MAX_HEADER_SIZE;
+  for (const BigInteger& value : values) {
+    size += record_size(value);
+  }
+  std::vector<std::byte> buffer(size);
+  std::byte* out = put_header(values.size(), buffer.data());
+  for (const BigInteger& value : values) {
+    out = put_record(value, out);
+  }
+  buffer.resize(out - buffer.data());
+  return buffer;
+}
+
+void serialize(std::ostream& os, std::span<const BigInteger> values) {
+  constexpr std::size_t CHUNK = 1 << 16;
+  std::vector<std::byte> buffer(std::max(CHUNK, MAX_HEADER_SIZE));
+  std::size_t used = put_header(values.size(), buffer.data()) - buffer.data();
+  for (const BigInteger& value : values) {
+    const std::size_t size = record_size(value);
+    if (used + size > buffer.size()) {
+      os.write(reinterpret_cast<const char*>(buffer.data()), used);
+      used = 0;
+      buffer.resize(std::max(buffer.size(), size));
+    }
+    used = put_record(value, buffer.data() + used) - buffer.data();
+  }
+  os.write(reinterpret_cast<const char*>(buffer.data()), used);
+}
+
+std::vector<BigIntegerView> deserialize_views(std::span<const std::byte> data) {
+  Reader reader(data);
+  if (!std::equal(MAGIC, MAGIC + sizeof(MAGIC),
+                  reinterpret_cast<const char*>(reader.take(sizeof(MAGIC))))) {
+    malformed();
+  }
+  if (std::to_integer<std::uint8_t>(*reader.take(1)) != VERSION) {
+    throw std::invalid_argument("Unsupported BigInteger serialization version");
+  }
+  const auto flags = std::to_integer<std::uint8_t>(*reader.take(1));
+  if ((flags & ~BIG_ENDIAN_LIMBS) != 0) {
+    malformed();
+  }
+  const bool big_endian = flags & BIG_ENDIAN_LIMBS;
+
+  const std::uint64_t count = reader.varint();
+  std::vector<BigIntegerView> views;
+  // Every record takes at least a byte, so a corrupt count cannot make this
+  // reserve more than the buffer could hold.
+  views.reserve(std::min<std::uint64_t>(count, reader.remaining()));
+  for (std::uint64_t i = 0; i < count; ++i) {
+    const std::uint64_t header = reader.varint();
+    const std::uint64_t size = header / 2;
+    const bool negative = header % 2 != 0;
+    if ((size == 0 && negative) || size > reader.remaining() / sizeof(Limb)) {
+      malformed();
+    }
+    views.emplace_back(reader.take(sizeof(Limb) * size), size, negative,
+                       big_endian);
+  }
+  if (!reader.done()) {
+    malformed();
+  }
+  return views;
+}
+
+std::vector<BigInteger> deserialize(std::span<const std::byte> data) {
+  std::vector<BigIntegerView> views = deserialize_views(data);
+  std::vector<BigInteger> values;
+  values.reserve(views.size());
+  for (const BigIntegerView& view : views) {
+    values.push_back(static_cast<BigInteger>(view));
+  }
+  return values;
+}
+
+MappedBigIntegers::MappedBigIntegers(const std::string& path) {
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::system_error(errno, std::generic_category(), "open " + path);
+  }
+  struct stat info;
+  int error = ::fstat(fd, &info) == 0 ? 0 : errno;
+  if (error == 0 && info.st_size > 0) {
+    length_ = static_cast<std::size_t>(info.st_size);
+    void* data = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      error = errno;
+      length_ = 0;
+    } else {
+      data_ = data;
+    }
+  }
+  ::close(fd);
+  if (error != 0) {
+    throw std::system_error(error, std::generic_category(), "mmap " + path);
+  }
+
+  try {
+    views_ = deserialize_views(
+        {static_cast<const std::byte*>(data_), length_});
+  } catch (...) {
+    unmap();
+    throw;
+  }
+}
+
+MappedBigIntegers::MappedBigIntegers(MappedBigIntegers&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      length_(std::exchange(other.length_, 0)),
+      views_(std::move(other.views_)) {
+  other.views_.clear();
+}
+
+MappedBigIntegers::~MappedBigIntegers() { unmap(); }
+
+MappedBigIntegers& MappedBigIntegers::operator=(
+    MappedBigIntegers&& other) noexcept {
+  if (this != &other) {
+    unmap();
+    data_ = std::exchange(other.data_, nullptr);
+    length_ = std::exchange(other.length_, 0);
+    views_ = std::move(other.views_);
+    other.views_.clear();
+  }
+  return *this;
+}
+
+void MappedBigIntegers::unmap() {
+  if (data_ != nullptr) {
+    ::munmap(data_, length_);
+    data_ = nullptr;
+    length_ = 0;
+  }
+  views_.clear();
+}
@@ -1,6 +1,84 @@
 #include <gtest/gtest.h>
 
+#include <climits>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
 #include "BigInteger.hpp"
+#include "BigIntegerBatch.hpp"
+#include "BigRational.hpp"
+#include "Expression.hpp"
+#include "FixedInt.hpp"
+#include "Modular.hpp"
+#include "Serialization.hpp"
+#include "StaticBigInteger.hpp"
+
+namespace {
+
+std::string random_digits(std::mt19937_64& rng, std::size_t count) {
+  std::uniform_int_distribution<int> digit(0, 9);
+  std::string result(count, '0');
+  for (char& c : result) {
+    c = static_cast<char>('0' + digit(rng));
+  }
+  result[0] = static_cast<char>('1' + digit(rng) % 9);
+  return result;
+}
+
+BigInteger multiply_with(const BigInteger& lhs, const BigInteger& rhs,
+                         std::size_t karatsuba, std::size_t toom3,
+                         std::size_t ntt = static_cast<std::size_t>(-1)) {
+  BigInteger::Thresholds saved = BigInteger::thresholds();
+  BigInteger::thresholds().karatsuba_multiply = karatsuba;
+  BigInteger::thresholds().toom3_multiply = toom3;
+  BigInteger::thresholds().ntt_multiply = ntt;
+  BigInteger result = lhs * rhs;
+  BigInteger::thresholds() = saved;
+  return result;
+}
+
+}  // namespace
+
+TEST(LimbVectorTest, SpillsFromInlineStorageToHeap) {
+  LimbVector limbs;
+  EXPECT_EQ(limbs.capacity(), LimbVector::INLINE_CAPACITY);
+
+  for (std::uint32_t i = 0; i < 100; ++i) {
+    limbs.push_back(i);
+  }
+  EXPECT_EQ(limbs.size(), 100u);
+  EXPECT_GE(limbs.capacity(), 100u);
+  for (std::uint32_t i = 0; i < 100; ++i) {
+    EXPECT_EQ(limbs[i], i);
+  }
+
+  limbs.resize(2);
+  EXPECT_EQ(limbs.back(), 1u);
+}
+
+TEST(LimbVectorTest, CopyAndMove) {
+  LimbVector small(3, 7);
+  LimbVector large(50, 9);
+
+  LimbVector small_copy = small;
+  LimbVector large_copy = large;
+  EXPECT_EQ(small_copy.size(), 3u);
+  EXPECT_EQ(large_copy[49], 9u);
+
+  LimbVector moved = std::move(large_copy);
+  EXPECT_EQ(moved.size(), 50u);
+  EXPECT_TRUE(large_copy.empty());
+
+  moved.swap(small_copy);
+  EXPECT_EQ(moved.size(), 3u);
+  EXPECT_EQ(small_copy.size(), 50u);
+
+  small_copy = small;
+  EXPECT_EQ(small_copy.size(), 3u);
+  EXPECT_EQ(small_copy[2], 7u);
+}
 
 TEST(BigIntegerTest, DefaultConstructor) {
   BigInteger num;
@@ -91,6 +169,65 @@ TEST(BigIntegerTest, CopyConstructor) {
   EXPECT_TRUE(copy == original);
 }
 
+TEST(BigIntegerTest, MoveConstructorAndAssignment) {
+  BigInteger original("-123456789012345678901234567890");
+  BigInteger moved = std::move(original);
+  EXPECT_EQ(moved, BigInteger("-123456789012345678901234567890"));
+
+  BigInteger target("42");
+  target = std::move(moved);
+  EXPECT_EQ(target, BigInteger("-123456789012345678901234567890"));
+
+  EXPECT_TRUE(original.is_zero());
+  original = BigInteger("7");
+  EXPECT_EQ(original, BigInteger("7"));
+}
+
+TEST(BigIntegerTest, RvalueOperators) {
+  BigInteger a("123456789012345678901234567890");
+  BigInteger b("-987654321098765432109876543210");
+
+  EXPECT_EQ(BigInteger(a) + b, a + b);
+  EXPECT_EQ(a + BigInteger(b), a + b);
+  EXPECT_EQ(BigInteger(a) + BigInteger(b), a + b);
+  EXPECT_EQ(BigInteger(a) - b, a - b);
+  EXPECT_EQ(a - BigInteger(b), a - b);
+  EXPECT_EQ(b - BigInteger(a), b - a);
+  EXPECT_EQ(BigInteger(a) - BigInteger(b), a - b);
+  EXPECT_EQ(a - BigInteger(a), BigInteger("0"));
+  EXPECT_EQ(BigInteger(a) * b, a * b);
+  EXPECT_EQ(a * BigInteger(b), a * b);
+  EXPECT_EQ(BigInteger(a) * BigInteger(b), a * b);
+  EXPECT_EQ(a * b,
+            BigInteger("-12193263113702179522618503273362292333223746380111"
+                       "1263526900"));
+  EXPECT_EQ(a * b + a * a - b, (a + b) * a - b);
+  EXPECT_EQ(BigInteger(b).abs(), BigInteger("987654321098765432109876543210"));
+}
+
+TEST(BigIntegerTest, CompoundAssignmentWithItself) {
+  BigInteger a("999999999999999999");
+  a += a;
+  EXPECT_EQ(a, BigInteger("1999999999999999998"));
+  a -= a;
+  EXPECT_EQ(a, BigInteger("0"));
+  EXPECT_FALSE(a.is_negative());
+
+  BigInteger b("-123456789");
+  b *= b;
+  EXPECT_EQ(b, BigInteger("15241578750190521"));
+}
+
+TEST(BigIntegerTest, MixedSignAccumulation) {
+  BigInteger total("-1000000000000000000");
+  total += BigInteger("1000000000000000001");
+  EXPECT_EQ(total, BigInteger("1"));
+  total -= BigInteger("1000000000000000000000");
+  EXPECT_EQ(total, BigInteger("-999999999999999999999"));
+  total += BigInteger("999999999999999999999");
+  EXPECT_EQ(total, BigInteger("0"));
+}
+
 TEST(BigIntegerTest, LargeNumbers) {
   std::string large_number = "1234567890123456789012345678901234567890";
   BigInteger num_large(large_number);
@@ -164,6 +301,102 @@ TEST(BigIntegerTest, Multiplication) {
   EXPECT_EQ(negative * negative, negativeResult);
 }
 
+TEST(BigIntegerTest, MultiplicationThresholdsBelowFourTerminate) {
+  std::mt19937_64 rng(43);
+  const std::size_t no_limit = static_cast<std::size_t>(-1);
+  for (std::size_t limbs = 1; limbs <= 6; ++limbs) {
+    BigInteger a(random_digits(rng, limbs * 9));
+    BigInteger b(random_digits(rng, limbs * 9 - 2));
+    BigInteger schoolbook = multiply_with(a, b, no_limit, no_limit);
+    for (std::size_t threshold = 0; threshold < 4; ++threshold) {
+      EXPECT_EQ(multiply_with(a, b, threshold, no_limit), schoolbook);
+      EXPECT_EQ(multiply_with(a, b, threshold, threshold), schoolbook);
+    }
+  }
+}
+
+TEST(BigIntegerTest, MultiplicationAlgorithmsAgree) {
+  std::mt19937_64 rng(42);
+  const std::size_t sizes[][2] = {{40, 40},   {100, 100}, {333, 334},
+                                  {700, 350}, {900, 120}, {1000, 999},
+                                  {1500, 1001}};
+  const std::size_t no_limit = static_cast<std::size_t>(-1);
+
+  for (const auto& size : sizes) {
+    BigInteger a(random_digits(rng, size[0] * 9));
+    BigInteger b("-" + random_digits(rng, size[1] * 9));
+
+    BigInteger schoolbook = multiply_with(a, b, no_limit, no_limit);
+    EXPECT_EQ(multiply_with(a, b, 4, no_limit), schoolbook);
+    EXPECT_EQ(multiply_with(a, b, 4, 12), schoolbook);
+    EXPECT_EQ(multiply_with(b, a, 4, 12), schoolbook);
+    EXPECT_EQ(multiply_with(a, b, 0, 0), schoolbook);
+    EXPECT_EQ(a * b, schoolbook);
+  }
+}
+
+TEST(BigIntegerTest, NttMultiplicationMatchesToom3) {
+  std::mt19937_64 rng(7);
+  const std::size_t sizes[][2] = {{1, 1}, {64, 64}, {513, 200}, {2000, 1999}};
+
+  for (const auto& size : sizes) {
+    BigInteger a(random_digits(rng, size[0] * 9));
+    BigInteger b(random_digits(rng, size[1] * 9));
+
+    BigInteger toom3 = multiply_with(a, b, 4, 12);
+    EXPECT_EQ(multiply_with(a, b, 4, 12, 1), toom3);
+    EXPECT_EQ(multiply_with(a, a, 4, 12, 1), multiply_with(a, a, 4, 12));
+  }
+
+  BigInteger max_limbs(std::string(9 * 3000, '9'));
+  EXPECT_EQ(multiply_with(max_limbs, max_limbs, 4, 12, 1),
+            multiply_with(max_limbs, max_limbs, 4, 12));
+}
+
+TEST(BigIntegerTest, MultiplicationLargeKnownValue) {
+  std::string nines(5000, '9');
+  std::string expected = std::string(4999, '9') + "8" +
+                         std::string(4999, '0') + "1";
+  BigInteger square = multiply_with(BigInteger(nines), BigInteger(nines), 4, 12);
+  EXPECT_EQ(square, BigInteger(expected));
+}
+
+TEST(BigIntegerTest, WordConversionKnownValues) {
+  EXPECT_TRUE(BigInteger(0LL).to_words().empty());
+  EXPECT_EQ(BigInteger(-5LL).to_words(), std::vector<std::uint64_t>{5});
+  EXPECT_EQ(BigInteger("18446744073709551616").to_words(),
+            (std::vector<std::uint64_t>{0, 1}));
+  EXPECT_EQ(BigInteger("340282366920938463463374607431768211455").to_words(),
+            (std::vector<std::uint64_t>{~0ULL, ~0ULL}));
+
+  std::vector<std::uint64_t> words = {0, 0, 1};
+  EXPECT_EQ(BigInteger::from_words(words, true),
+            BigInteger("-340282366920938463463374607431768211456"));
+  EXPECT_TRUE(BigInteger::from_words({}).is_zero());
+}
+
+TEST(BigIntegerTest, WordConversionRoundTrip) {
+  std::mt19937_64 rng(5);
+  BigInteger::Thresholds saved = BigInteger::thresholds();
+
+  for (std::size_t leaf : {std::size_t{1}, std::size_t{16}}) {
+    BigInteger::thresholds().radix_conversion = leaf;
+    for (std::size_t digits : {1, 19, 20, 200, 2000, 9000}) {
+      BigInteger value(random_digits(rng, digits));
+      std::vector<std::uint64_t> words = value.to_words();
+      EXPECT_EQ(BigInteger::from_words(words), value);
+
+      std::vector<std::uint64_t> random_words(digits / 19 + 1);
+      for (std::uint64_t& word : random_words) {
+        word = rng();
+      }
+      EXPECT_EQ(BigInteger::from_words(random_words).to_words(), random_words);
+    }
+  }
+
+  BigInteger::thresholds() = saved;
+}
+
 TEST(BigIntegerTest, Division) {
   BigInteger a("83810205");
   BigInteger b("12345");
@@ -182,6 +415,47 @@ TEST(BigIntegerTest, Division) {
   EXPECT_THROW(a / BigInteger("0"), std::invalid_argument);
 }
 
+TEST(BigIntegerTest, DivModReconstructsDividend) {
+  std::mt19937_64 rng(11);
+  const std::size_t sizes[][2] = {{1, 1},     {5, 2},     {40, 39},
+                                  {300, 100}, {700, 170}, {1200, 600}};
+  BigInteger::Thresholds saved = BigInteger::thresholds();
+
+  for (std::size_t threshold :
+       {std::size_t{0}, std::size_t{1}, std::size_t{4}, std::size_t{40}}) {
+    BigInteger::thresholds().burnikel_ziegler_divide = threshold;
+    for (const auto& size : sizes) {
+      BigInteger a(random_digits(rng, size[0] * 9 - 3));
+      BigInteger b("-" + random_digits(rng, size[1] * 9 - 5));
+
+      auto [quotient, remainder] = divmod(a, b);
+      EXPECT_EQ(quotient * b + remainder, a);
+      EXPECT_LT(remainder.abs(), b.abs());
+      EXPECT_FALSE(remainder.is_negative());
+      EXPECT_EQ(a / b, quotient);
+      EXPECT_EQ(a % b, remainder);
+    }
+  }
+
+  BigInteger::thresholds() = saved;
+}
+
+TEST(BigIntegerTest, DivModSigns) {
+  auto [q1, r1] = divmod(BigInteger(-7), BigInteger(2));
+  EXPECT_EQ(q1, BigInteger(-3));
+  EXPECT_EQ(r1, BigInteger(-1));
+
+  auto [q2, r2] = divmod(BigInteger(7), BigInteger(-2));
+  EXPECT_EQ(q2, BigInteger(-3));
+  EXPECT_EQ(r2, BigInteger(1));
+
+  auto [q3, r3] = divmod(BigInteger(3), BigInteger(10));
+  EXPECT_EQ(q3, BigInteger(0LL));
+  EXPECT_EQ(r3, BigInteger(3));
+
+  EXPECT_THROW(divmod(BigInteger(1), BigInteger(0LL)), std::invalid_argument);
+}
+
 TEST(BigIntegerTest, Modulus) {
   BigInteger a("83810205");
   BigInteger b("12345");
@@ -198,14 +472,140 @@ TEST(BigIntegerTest, Exponentiation) {
   BigInteger base("2");
   BigInteger exponent("10");
   BigInteger expected("1024");
-  EXPECT_EQ(base ^ exponent, expected);
+  EXPECT_EQ(pow(base, exponent), expected);
 
   BigInteger zero("0");
   BigInteger one("1");
-  EXPECT_EQ(base ^ zero, one);
-  EXPECT_EQ(zero ^ exponent, zero);
+  EXPECT_EQ(pow(base, zero), one);
+  EXPECT_EQ(pow(zero, exponent), zero);
+
+  EXPECT_THROW(pow(base, BigInteger("-1")), std::invalid_argument);
+}
+
+TEST(BigIntegerTest, BitwiseOperators) {
+  BigInteger a("-123456789012345678901234567890");
+  BigInteger b("987654321098765432109876543210");
+
+  EXPECT_EQ(a & b, BigInteger("985710360914275162674813760554"));
+  EXPECT_EQ(a | b, BigInteger("-121512828827855409466171785234"));
+  EXPECT_EQ(a ^ b, BigInteger("-1107223189742130572140985545788"));
+  EXPECT_EQ(~a, BigInteger("123456789012345678901234567889"));
+  EXPECT_EQ(BigInteger(-5) & BigInteger(3), 3);
+  EXPECT_EQ(BigInteger(-5) ^ BigInteger(3), -8);
+
+  BigInteger c = a;
+  c ^= b;
+  c ^= b;
+  EXPECT_EQ(c, a);
+}
+
+TEST(BigIntegerTest, Shifts) {
+  BigInteger a("-123456789012345678901234567890");
+
+  EXPECT_EQ(a << 65,
+            BigInteger("-4554751582145396280496781676045123416022822420480"));
+  EXPECT_EQ(a >> 70, -104571968);
+  EXPECT_EQ((a << 200) >> 200, a);
+  EXPECT_EQ(BigInteger(-1) >> 1, -1);
+  EXPECT_EQ(BigInteger(-7) >> 1, -4);
+  EXPECT_EQ(a >> 1000, -1);
+  EXPECT_EQ(a.abs() >> 1000, 0);
+
+  EXPECT_EQ(a.bit_length(), 97u);
+  EXPECT_EQ(a.popcount(), 54u);
+  EXPECT_EQ(BigInteger(0LL).bit_length(), 0u);
+}
+
+TEST(BigIntegerTest, FusedProducts) {
+  std::mt19937_64 rng(17);
+  BigInteger a(random_digits(rng, 40));
+  BigInteger b("-" + random_digits(rng, 900));
+  BigInteger c(random_digits(rng, 2000));
+  BigInteger d(random_digits(rng, 3000));
+
+  BigInteger total = c;
+  total.add_product(a, b).add_product(c, d).subtract_product(d, a);
+  EXPECT_EQ(total, c + a * b + c * d - d * a);
+
+  BigInteger self = a;
+  self.add_product(self, self);
+  EXPECT_EQ(self, a + a * a);
+
+  EXPECT_EQ(multiply_remainder(b, c, a), b * c % a);
+  EXPECT_EQ(multiply_remainder(a, a, d), a * a);
+  EXPECT_THROW(multiply_remainder(a, b, BigInteger()), std::invalid_argument);
+
+  std::vector<BigInteger> terms = {a, b, c, d, b, BigInteger(-1), a};
+  EXPECT_EQ(sum(terms), a + b + c + d + b - 1 + a);
+  EXPECT_EQ(sum(std::span<const BigInteger>()), 0);
+}
+
+TEST(BigIntegerTest, ExpressionTemplates) {
+  std::mt19937_64 rng(18);
+  BigInteger a(random_digits(rng, 300));
+  BigInteger b("-" + random_digits(rng, 200));
+  BigInteger c(random_digits(rng, 100));
+  BigInteger m(random_digits(rng, 50));
+
+  BigInteger value = lazy(a) * b + lazy(c) * c - a;
+  EXPECT_EQ(value, a * b + c * c - a);
+  EXPECT_EQ(BigInteger(-(lazy(a) * b) + c), c - a * b);
+  EXPECT_EQ((lazy(a) * b) % m, a * b % m);
+
+  value += lazy(value) * a - b;
+  EXPECT_EQ(value, (a * b + c * c - a) * (1 + a) - b);
+  value -= lazy(b) * c;
+  EXPECT_EQ(value, (a * b + c * c - a) * (1 + a) - b - b * c);
+}
+
+TEST(BigIntegerTest, MachineIntegerOperands) {
+  BigInteger a("123456789012345678901234567890");
+
+  EXPECT_EQ(a * 10, BigInteger("1234567890123456789012345678900"));
+  EXPECT_EQ(-3 * a, BigInteger("-370370367037037036703703703670"));
+  EXPECT_EQ(a / 2, BigInteger("61728394506172839450617283945"));
+  EXPECT_EQ(a / -7, BigInteger("-17636684144620811271604938270"));
+  EXPECT_EQ(a % 2, 0);
+  EXPECT_EQ(a % 7, 0);
+  EXPECT_EQ(BigInteger("-1000000007") % 10, -7);
+  EXPECT_EQ(a % 10'000'000'000LL, 1'234'567'890LL);
+  EXPECT_EQ(a + 1, BigInteger("123456789012345678901234567891"));
+  EXPECT_EQ(1 - a, BigInteger("-123456789012345678901234567889"));
+  EXPECT_EQ(BigInteger("999999999") + 1, BigInteger("1000000000"));
+  EXPECT_EQ(BigInteger("1000000000") - 1, BigInteger("999999999"));
+  EXPECT_EQ(BigInteger(5LL) - 8, BigInteger(-3LL));
+  EXPECT_EQ(BigInteger(-5LL) + 5, BigInteger(0LL));
+  EXPECT_EQ(a * 4'000'000'000LL,
+            BigInteger("493827156049382715604938271560000000000"));
+
+  BigInteger b = a;
+  b *= 0;
+  EXPECT_TRUE(b.is_zero());
+  EXPECT_FALSE(b.is_negative());
+
+  EXPECT_THROW(a / 0, std::invalid_argument);
+  EXPECT_THROW(a % 0, std::invalid_argument);
+  EXPECT_EQ(BigInteger(LLONG_MIN), BigInteger("-9223372036854775808"));
+}
 
-  EXPECT_THROW(base ^ BigInteger("-1"), std::invalid_argument);
+TEST(BigIntegerTest, ZeroAndParityQueries) {
+  EXPECT_TRUE(BigInteger().is_zero());
+  EXPECT_FALSE(BigInteger(-1LL).is_zero());
+  EXPECT_TRUE(BigInteger("1000000001").is_odd());
+  EXPECT_FALSE(BigInteger("-1000000000").is_odd());
+  EXPECT_TRUE(BigInteger(-3LL).is_odd());
+}
+
+TEST(BigIntegerTest, MachineIntegerComparison) {
+  BigInteger big("123456789012345678901234567890");
+  EXPECT_TRUE(big > 0);
+  EXPECT_TRUE(big > LLONG_MAX);
+  EXPECT_TRUE(-1 < BigInteger(0LL));
+  EXPECT_TRUE(BigInteger(-5LL) < -4);
+  EXPECT_TRUE(BigInteger(-5LL) == -5);
+  EXPECT_TRUE(BigInteger("1000000000") == 1'000'000'000);
+  EXPECT_TRUE(BigInteger(LLONG_MIN) == LLONG_MIN);
+  EXPECT_TRUE(BigInteger(7LL) != 8);
 }
 
 TEST(BigIntegerTest, PrefixIncrement) {
@@ -297,6 +697,206 @@ TEST(BigIntegerTest, SqrtNegativeNumbers) {
   EXPECT_THROW(sqrt(BigInteger("-100")), std::invalid_argument);
 }
 
+TEST(BigIntegerTest, IsqrtRemReconstructsRadicand) {
+  std::mt19937_64 rng(7);
+  for (std::size_t digits : {1, 9, 10, 18, 19, 37, 100, 1000, 5000}) {
+    BigInteger n(random_digits(rng, digits));
+    auto [root, remainder] = isqrt_rem(n);
+    EXPECT_EQ(root * root + remainder, n);
+    EXPECT_FALSE(remainder.is_negative());
+    EXPECT_LE(remainder, root + root);
+  }
+
+  BigInteger square("123456789012345678901234567890123456789");
+  square *= square;
+  auto [root, remainder] = isqrt_rem(square);
+  EXPECT_EQ(root, BigInteger("123456789012345678901234567890123456789"));
+  EXPECT_TRUE(remainder.is_zero());
+  EXPECT_THROW(isqrt_rem(BigInteger("-4")), std::invalid_argument);
+}
+
+TEST(BigIntegerTest, NthRoot) {
+  EXPECT_EQ(nth_root(BigInteger("27"), 3), BigInteger("3"));
+  EXPECT_EQ(nth_root(BigInteger("26"), 3), BigInteger("2"));
+  EXPECT_EQ(nth_root(BigInteger("-27"), 3), BigInteger("-3"));
+  EXPECT_EQ(nth_root(BigInteger("1"), 5), BigInteger("1"));
+  EXPECT_EQ(nth_root(BigInteger("12345"), 1), BigInteger("12345"));
+  EXPECT_EQ(nth_root(BigInteger("1000000000000000000000000000000"), 10),
+            BigInteger("1000"));
+  EXPECT_EQ(nth_root(BigInteger("999999999999999999999999999999"), 10),
+            BigInteger("999"));
+
+  std::mt19937_64 rng(8);
+  for (unsigned k : {3u, 4u, 7u, 20u}) {
+    BigInteger n(random_digits(rng, 500));
+    BigInteger root = nth_root(n, k);
+    BigInteger above = root + 1;
+    EXPECT_LE(pow(root, BigInteger(k)), n);
+    EXPECT_GT(pow(above, BigInteger(k)), n);
+  }
+
+  EXPECT_THROW(nth_root(BigInteger("-16"), 4), std::invalid_argument);
+  EXPECT_THROW(nth_root(BigInteger("16"), 0), std::invalid_argument);
+}
+
+TEST(BigIntegerTest, Gcd) {
+  EXPECT_EQ(gcd(BigInteger(12), BigInteger(18)), BigInteger(6));
+  EXPECT_EQ(gcd(BigInteger(-12), BigInteger(18)), BigInteger(6));
+  EXPECT_EQ(gcd(BigInteger(0LL), BigInteger(-7)), BigInteger(7));
+  EXPECT_EQ(gcd(BigInteger(0LL), BigInteger(0LL)), BigInteger(0LL));
+  EXPECT_EQ(gcd(NthFibonacci(300), NthFibonacci(299)), BigInteger(1));
+  EXPECT_EQ(gcd(NthFibonacci(300), NthFibonacci(200)), NthFibonacci(100));
+
+  EXPECT_EQ(lcm(BigInteger(4), BigInteger(-6)), BigInteger(12));
+  EXPECT_EQ(lcm(BigInteger(0LL), BigInteger(5)), BigInteger(0LL));
+}
+
+TEST(BigIntegerTest, GcdAlgorithmsAgree) {
+  std::mt19937_64 rng(11);
+  BigInteger::Thresholds saved = BigInteger::thresholds();
+
+  for (std::size_t digits : {30, 400, 3000}) {
+    BigInteger common(random_digits(rng, digits / 3));
+    BigInteger a = BigInteger(random_digits(rng, digits)) * common;
+    BigInteger b = BigInteger(random_digits(rng, digits - 7)) * common;
+
+    BigInteger::thresholds().half_gcd = 1'000'000;
+    BigInteger lehmer = gcd(a, b);
+    BigInteger::thresholds().half_gcd = 4;
+    BigInteger recursive = gcd(a, b);
+    auto [g, x, y] = extended_gcd(a, b);
+
+    EXPECT_EQ(lehmer, recursive);
+    EXPECT_EQ(g, lehmer);
+    EXPECT_TRUE((lehmer % common).is_zero());
+    EXPECT_EQ(gcd(a / lehmer, b / lehmer), BigInteger(1));
+    EXPECT_EQ(a * x + b * y, g);
+  }
+
+  BigInteger::thresholds() = saved;
+}
+
+TEST(BigIntegerTest, ExtendedGcd) {
+  auto [g, x, y] = extended_gcd(BigInteger(240), BigInteger(46));
+  EXPECT_EQ(g, BigInteger(2));
+  EXPECT_EQ(BigInteger(240) * x + BigInteger(46) * y, g);
+
+  for (auto [a, b] : {std::pair<long long, long long>{-240, 46},
+                      {240, -46},
+                      {-46, -240},
+                      {0, 9},
+                      {9, 0},
+                      {0, 0}}) {
+    auto [g2, x2, y2] = extended_gcd(BigInteger(a), BigInteger(b));
+    EXPECT_EQ(g2, gcd(BigInteger(a), BigInteger(b)));
+    EXPECT_EQ(BigInteger(a) * x2 + BigInteger(b) * y2, g2);
+  }
+}
+
+TEST(BigIntegerTest, PowMod) {
+  EXPECT_EQ(powmod(BigInteger(2), BigInteger(10), BigInteger(1000)),
+            BigInteger(24));
+  EXPECT_EQ(powmod(BigInteger(5), BigInteger(0LL), BigInteger(7)),
+            BigInteger(1));
+  EXPECT_EQ(powmod(BigInteger(5), BigInteger(3), BigInteger(1)),
+            BigInteger(0LL));
+  EXPECT_EQ(powmod(BigInteger(-2), BigInteger(3), BigInteger(7)),
+            BigInteger(6));
+  EXPECT_EQ(powmod(BigInteger(7), BigInteger(-3), BigInteger(1000003)),
+            BigInteger(259476));
+
+  BigInteger base = pow(BigInteger(3), BigInteger(90));
+  BigInteger exponent = pow(BigInteger(2), BigInteger(100)) + 7;
+  BigInteger modulus = pow(BigInteger(10), BigInteger(40)) + 123;
+  BigInteger expected("2837822122447952526059080296914706995995");
+  EXPECT_EQ(powmod(base, exponent, modulus), expected);
+  EXPECT_EQ(MontgomeryContext(modulus).pow(base, exponent), expected);
+  EXPECT_EQ(BarrettContext(modulus).pow(base, exponent), expected);
+
+  // Moduli sharing a factor with 10 go through Barrett reduction.
+  BigInteger even_modulus = pow(BigInteger(2), BigInteger(64)) * 125;
+  EXPECT_EQ(powmod(BigInteger("1234567890123456789"),
+                   pow(BigInteger(10), BigInteger(30)) + 1, even_modulus),
+            BigInteger("1432248343165844160789"));
+
+  BigInteger prime("170141183460469231731687303715884105727");
+  std::mt19937_64 rng(9);
+  for (int i = 0; i < 5; ++i) {
+    BigInteger a(random_digits(rng, 30));
+    EXPECT_EQ(powmod(a, prime - 1, prime), BigInteger(1));
+  }
+
+  EXPECT_THROW(powmod(BigInteger(2), BigInteger(3), BigInteger(0LL)),
+               std::invalid_argument);
+  EXPECT_THROW(MontgomeryContext(BigInteger(1000)), std::invalid_argument);
+}
+
+TEST(BigIntegerTest, ReductionContextsAgreeWithDivision) {
+  std::mt19937_64 rng(10);
+  BigInteger modulus(random_digits(rng, 200));
+  if (modulus % 2 == 0) {
+    modulus += 1;
+  }
+  if (modulus % 5 == 0) {
+    modulus += 2;
+  }
+  BarrettContext barrett(modulus);
+  MontgomeryContext montgomery(modulus);
+
+  for (int i = 0; i < 20; ++i) {
+    BigInteger a = BigInteger(random_digits(rng, 150)) % modulus;
+    BigInteger b = BigInteger(random_digits(rng, 199)) % modulus;
+    BigInteger expected = a * b % modulus;
+    EXPECT_EQ(mulmod(a, b, modulus), expected);
+    EXPECT_EQ(barrett.multiply(a, b), expected);
+    EXPECT_EQ(montgomery.from_montgomery(montgomery.multiply(
+                  montgomery.to_montgomery(a), montgomery.to_montgomery(b))),
+              expected);
+  }
+  EXPECT_EQ(barrett.reduce(BigInteger(-5)), modulus - 5);
+
+  // Montgomery operands outside [0, m) are reduced first.
+  BigInteger large(random_digits(rng, 300));
+  BigInteger negative("-" + random_digits(rng, 250));
+  EXPECT_EQ(montgomery.multiply(large, negative),
+            montgomery.multiply(barrett.reduce(large),
+                                barrett.reduce(negative)));
+  EXPECT_EQ(montgomery.from_montgomery(negative),
+            montgomery.from_montgomery(barrett.reduce(negative)));
+  MontgomeryContext small(BigInteger(1000000007LL));
+  BigInteger unreduced("123456789012345678901234567890");
+  EXPECT_EQ(small.multiply(unreduced, small.to_montgomery(1LL)),
+            BigInteger(197434842));
+  // unreduced * BASE^-2 mod m; the modulus takes two limbs.
+  EXPECT_EQ(small.from_montgomery(unreduced), BigInteger(779539492));
+}
+
+TEST(BigIntegerTest, InvMod) {
+  EXPECT_EQ(invmod(BigInteger(3), BigInteger(11)), BigInteger(4));
+  EXPECT_EQ(invmod(BigInteger(-3), BigInteger(11)), BigInteger(7));
+  BigInteger base = pow(BigInteger(3), BigInteger(90));
+  BigInteger modulus = pow(BigInteger(10), BigInteger(40)) + 123;
+  EXPECT_EQ(invmod(base, modulus),
+            BigInteger("5535998432384866825059062791794501328341"));
+  EXPECT_THROW(invmod(BigInteger(4), BigInteger(10)), std::invalid_argument);
+}
+
+TEST(BigIntegerTest, IsPerfectSquare) {
+  EXPECT_TRUE(is_perfect_square(BigInteger("0")));
+  EXPECT_TRUE(is_perfect_square(BigInteger("1")));
+  EXPECT_TRUE(is_perfect_square(BigInteger("1000000000000000000")));
+  EXPECT_FALSE(is_perfect_square(BigInteger("2")));
+  EXPECT_FALSE(is_perfect_square(BigInteger("-4")));
+
+  BigInteger root("98765432109876543210987654321");
+  BigInteger square = root * root;
+  EXPECT_TRUE(is_perfect_square(square));
+  EXPECT_FALSE(is_perfect_square(square + 1));
+  EXPECT_FALSE(is_perfect_square(square - 1));
+  // 1 mod 64, 63, 65 and 11, so only the root itself rules it out.
+  EXPECT_FALSE(is_perfect_square(BigInteger("2882880001")));
+}
+
 TEST(BigIntegerTest, TestEquality) {
   BigInteger num1("12345");
   BigInteger num2("12345");
@@ -507,31 +1107,417 @@ TEST(BigIntegerTest, ReadNegativeZero) {
   EXPECT_EQ(bi, BigInteger("0"));
 }
 
-// TEST(BigIntegerTests, NthCatalan) {
-//   EXPECT_EQ(NthCatalan(0), BigInteger(1));
-//   EXPECT_EQ(NthCatalan(1), BigInteger(1));
-//   EXPECT_EQ(NthCatalan(2), BigInteger(2));
-//   EXPECT_EQ(NthCatalan(3), BigInteger(5));
-//   EXPECT_EQ(NthCatalan(4), BigInteger(14));
-//   EXPECT_EQ(NthCatalan(5), BigInteger(42));
-
-//   EXPECT_EQ(NthCatalan(10), BigInteger(16796));
-// }
-
-// TEST(BigIntegerTest, Factorial) {
-//     EXPECT_EQ(factorial(0), BigInteger("1"));
-//     EXPECT_EQ(factorial(1), BigInteger("1"));
-//     EXPECT_EQ(factorial(2), BigInteger("2"));
-//     EXPECT_EQ(factorial(3), BigInteger("6"));
-//     EXPECT_EQ(factorial(4), BigInteger("24"));
-//     EXPECT_EQ(factorial(5), BigInteger("120"));
-// }
-
-// TEST(BigIntegerTest, NthFibonacci) {
-//     EXPECT_EQ(NthFibonacci(0), BigInteger("0"));
-//     EXPECT_EQ(NthFibonacci(1), BigInteger("1"));
-//     EXPECT_EQ(NthFibonacci(2), BigInteger("1"));
-//     EXPECT_EQ(NthFibonacci(3), BigInteger("2"));
-//     EXPECT_EQ(NthFibonacci(4), BigInteger("3"));
-//     EXPECT_EQ(NthFibonacci(5), BigInteger("5"));
-// }
+TEST(BigIntegerTest, PrintPadsInnerLimbs) {
+  std::ostringstream oss;
+  oss << BigInteger("-1000000000000000007") << ' ' << BigInteger("-0");
+  EXPECT_EQ(oss.str(), "-1000000000000000007 0");
+  EXPECT_EQ(BigInteger("000000000000000000012").to_string(), "12");
+}
+
+TEST(BigIntegerTest, StreamRoundTrip) {
+  std::mt19937_64 rng(6);
+  for (std::size_t digits : {1, 8, 9, 10, 17, 18, 19, 1000, 100000}) {
+    std::string text = "-" + random_digits(rng, digits);
+    std::istringstream input(text + " 42");
+    BigInteger bi;
+    input >> bi;
+    EXPECT_EQ(bi.to_string(), text);
+
+    std::ostringstream output;
+    output << bi;
+    EXPECT_EQ(output.str(), text);
+    input >> bi;
+    EXPECT_EQ(bi, 42);
+  }
+}
+
+TEST(BigIntegerTest, ToCharsAndFromChars) {
+  BigInteger value("-123456789012345678901234567890");
+  char buffer[64];
+  auto [end, error] = to_chars(buffer, buffer + sizeof(buffer), value);
+  ASSERT_EQ(error, std::errc());
+  EXPECT_EQ(std::string(buffer, end), "-123456789012345678901234567890");
+
+  auto [short_end, short_error] = to_chars(buffer, buffer + 30, value);
+  EXPECT_EQ(short_error, std::errc::value_too_large);
+  EXPECT_EQ(short_end, buffer + 30);
+
+  const std::string text = "98765432109876543210x";
+  BigInteger parsed;
+  auto [stop, parse_error] =
+      from_chars(text.data(), text.data() + text.size(), parsed);
+  EXPECT_EQ(parse_error, std::errc());
+  EXPECT_EQ(stop, text.data() + 20);
+  EXPECT_EQ(parsed, BigInteger("98765432109876543210"));
+
+  for (const char* invalid : {"", "-", "x1", "+1"}) {
+    auto [invalid_end, invalid_error] =
+        from_chars(invalid, invalid + std::strlen(invalid), parsed);
+    EXPECT_EQ(invalid_error, std::errc::invalid_argument);
+    EXPECT_EQ(invalid_end, invalid);
+  }
+  EXPECT_EQ(parsed, BigInteger("98765432109876543210"));
+}
+
+TEST(BigIntegerTest, StringConstructorRejectsMalformedInput) {
+  EXPECT_THROW(BigInteger(""), std::invalid_argument);
+  EXPECT_THROW(BigInteger("-"), std::invalid_argument);
+  EXPECT_THROW(BigInteger("12345678901234567890:"), std::invalid_argument);
+  EXPECT_THROW(BigInteger("1234 5678"), std::invalid_argument);
+}
+
+TEST(BigIntegerTests, NthCatalan) {
+  EXPECT_EQ(NthCatalan(0), BigInteger(1));
+  EXPECT_EQ(NthCatalan(1), BigInteger(1));
+  EXPECT_EQ(NthCatalan(2), BigInteger(2));
+  EXPECT_EQ(NthCatalan(3), BigInteger(5));
+  EXPECT_EQ(NthCatalan(4), BigInteger(14));
+  EXPECT_EQ(NthCatalan(5), BigInteger(42));
+
+  EXPECT_EQ(NthCatalan(10), BigInteger(16796));
+  EXPECT_EQ(NthCatalan(100),
+            BigInteger("896519947090131496687170070074100632420837521538745909"
+                       "320"));
+}
+
+TEST(BigIntegerTest, Factorial) {
+    EXPECT_EQ(factorial(0), BigInteger("1"));
+    EXPECT_EQ(factorial(1), BigInteger("1"));
+    EXPECT_EQ(factorial(2), BigInteger("2"));
+    EXPECT_EQ(factorial(3), BigInteger("6"));
+    EXPECT_EQ(factorial(4), BigInteger("24"));
+    EXPECT_EQ(factorial(5), BigInteger("120"));
+}
+
+TEST(BigIntegerTest, NthFibonacci) {
+    EXPECT_EQ(NthFibonacci(0), BigInteger("0"));
+    EXPECT_EQ(NthFibonacci(1), BigInteger("1"));
+    EXPECT_EQ(NthFibonacci(2), BigInteger("1"));
+    EXPECT_EQ(NthFibonacci(3), BigInteger("2"));
+    EXPECT_EQ(NthFibonacci(4), BigInteger("3"));
+    EXPECT_EQ(NthFibonacci(5), BigInteger("5"));
+}
+
+TEST(BigIntegerTest, FactorialMatchesSequentialProduct) {
+  BigInteger expected = 1LL;
+  for (int n = 1; n <= 600; ++n) {
+    expected *= n;
+    if (n % 37 == 0 || n == 600) {
+      EXPECT_EQ(factorial(n), expected) << n;
+    }
+  }
+  EXPECT_THROW(factorial(-1), std::invalid_argument);
+}
+
+TEST(BigIntegerTest, FibonacciAndLucasRecurrences) {
+  BigInteger f0 = 0LL, f1 = 1LL;
+  BigInteger l0 = 2LL, l1 = 1LL;
+  for (std::size_t n = 0; n <= 300; ++n) {
+    EXPECT_EQ(NthFibonacci(n), f0) << n;
+    EXPECT_EQ(NthLucas(n), l0) << n;
+    f0 += f1;
+    std::swap(f0, f1);
+    l0 += l1;
+    std::swap(l0, l1);
+  }
+  EXPECT_EQ(NthFibonacci(1000).to_string().substr(0, 20),
+            "43466557686937456435");
+}
+
+TEST(BigIntegerTest, Binomial) {
+  EXPECT_EQ(binomial(0, 0), BigInteger(1));
+  EXPECT_EQ(binomial(5, 2), BigInteger(10));
+  EXPECT_EQ(binomial(5, 6), BigInteger(0LL));
+  EXPECT_EQ(binomial(5, -1), BigInteger(0LL));
+  EXPECT_EQ(binomial(100, 50),
+            BigInteger("100891344545564193334812497256"));
+
+  for (int n = 1; n <= 60; n += 7) {
+    for (int k = 1; k <= n; ++k) {
+      EXPECT_EQ(binomial(n, k), binomial(n - 1, k - 1) + binomial(n - 1, k));
+    }
+  }
+  EXPECT_THROW(binomial(-1, 0), std::invalid_argument);
+}
+
+TEST(BigIntegerTest, ParallelProductsMatchSerial) {
+  std::mt19937_64 rng(21);
+  BigInteger a(random_digits(rng, 30000));
+  BigInteger b(random_digits(rng, 30000));
+  BigInteger c(random_digits(rng, 5000));
+  std::vector<BigInteger> factors;
+  for (int i = 0; i < 40; ++i) {
+    factors.emplace_back(random_digits(rng, 500));
+  }
+  BigInteger expected_toom = multiply_with(a, b, 40, 150);
+  BigInteger expected_unbalanced = multiply_with(a, c, 40, 150);
+  BigInteger expected_ntt = a * b;
+  BigInteger expected_factorial = factorial(3000);
+  BigInteger expected_product = 1LL;
+  for (const BigInteger& factor : factors) {
+    expected_product *= factor;
+  }
+
+  BigInteger::Thresholds saved = BigInteger::thresholds();
+  BigInteger::set_thread_count(4);
+  BigInteger::thresholds().parallel_multiply = 20;
+  EXPECT_EQ(multiply_with(a, b, 40, 150), expected_toom);
+  EXPECT_EQ(multiply_with(a, c, 40, 150), expected_unbalanced);
+  EXPECT_EQ(multiply_with(a, b, 40, 150, 300), expected_ntt);
+  EXPECT_EQ(factorial(3000), expected_factorial);
+  EXPECT_EQ(product(factors), expected_product);
+  BigInteger::set_thread_count(1);
+  BigInteger::thresholds() = saved;
+
+  EXPECT_EQ(product(std::span<const BigInteger>()), 1);
+  EXPECT_EQ(BigInteger::thread_count(), 1u);
+}
+
+TEST(StaticBigIntegerTest, ConstantExpressions) {
+  constexpr auto modulus = 1'000'000'007_big;
+  constexpr auto large = 123456789012345678901234567890_big;
+  constexpr auto square = large * large - modulus;
+  static_assert(large.capacity() == 4);
+  static_assert(square > large);
+  static_assert(-large < 0);
+  static_assert(large - large == 0);
+  static_assert(modulus * 2 == 2'000'000'014_big);
+  static_assert(StaticBigInteger<1>(999'999'999) + 1 == 1'000'000'000_big);
+
+  EXPECT_EQ(BigInteger(square),
+            BigInteger("1524157875323883675049535156253619878750190519987"
+                       "4019052093"));
+  EXPECT_EQ(BigInteger(-large) * large, BigInteger(large) * -1 * large);
+
+  std::mt19937_64 rng(14);
+  const std::string digits = random_digits(rng, 9000);
+  EXPECT_EQ(BigInteger(StaticBigInteger<1000>("-" + digits)),
+            BigInteger("-" + digits));
+  EXPECT_EQ(BigInteger(StaticBigInteger<4>()), 0);
+  EXPECT_FALSE(BigInteger(-StaticBigInteger<4>()).is_negative());
+}
+
+TEST(StaticBigIntegerTest, CompoundAssignmentKeepsCapacity) {
+  StaticBigInteger<2> value(999'999'999'999'999'999LL);
+  value -= 999'999'999'999'999'998LL;
+  EXPECT_EQ(value, 1);
+  value *= -1;
+  EXPECT_TRUE(value.is_negative());
+
+  StaticBigInteger<2> full("999999999999999999");
+  EXPECT_THROW(full += 1, std::overflow_error);
+  EXPECT_THROW(StaticBigInteger<1>("1000000000"), std::overflow_error);
+  EXPECT_THROW(StaticBigInteger<1>("12a"), std::invalid_argument);
+  EXPECT_EQ(StaticBigInteger<1>("-000'123"), -123);
+}
+
+TEST(FixedIntTest, WideArithmetic) {
+  uint256 a("6249203505451628849692820439375744481966954417427815084560");
+  uint256 b("1512366075204170929049582354406559215");
+
+  EXPECT_EQ(BigInteger(a * b),
+            BigInteger("1650022976312096855479947595511664166411221293670"
+                       "7441349890607418508860034288"));
+  EXPECT_EQ(a / b, uint256("4132070672510939615984"));
+  EXPECT_EQ(a % b, uint256("1066978041981904958592000"));
+  EXPECT_EQ(divmod(a, b), std::make_pair(a / b, a % b));
+  EXPECT_EQ(BigInteger(a << 100),
+            BigInteger("4580220464732149597580566436847434675754256723524"
+                       "9230885785341200199378272256"));
+  EXPECT_EQ((a << 100) >> 100 << 100, a << 100);
+  EXPECT_EQ(uint256(0) - 1, uint256::max());
+  EXPECT_THROW(a / 0, std::invalid_argument);
+}
+
+TEST(FixedIntTest, SignedSemantics) {
+  static_assert(int128(-7) / 2 == -3);
+  static_assert(int128(-7) % 2 == -1);
+  static_assert(int128(-7) >> 1 == -4);
+  static_assert(int128::max() + 1 == int128::min());
+  static_assert(int128(-1) < int128(0));
+
+  EXPECT_EQ(BigInteger(int128::min()),
+            BigInteger("-170141183460469231731687303715884105728"));
+  EXPECT_EQ(int128::min().bit_length(), 128u);
+  EXPECT_EQ(int512(-255).popcount(), 8u);
+  EXPECT_EQ((int256(-6) & int256(3)).to_string(), "2");
+}
+
+TEST(FixedIntTest, BigIntegerConversionIsLossless) {
+  BigInteger value("-123456789012345678901234567890123456789");
+  EXPECT_EQ(BigInteger(int256(value)), value);
+  EXPECT_EQ(BigInteger(int128(BigInteger("-170141183460469231731687303715884"
+                                         "105728"))),
+            BigInteger(int128::min()));
+  EXPECT_THROW(int128(BigInteger("170141183460469231731687303715884105728")),
+               std::overflow_error);
+  EXPECT_THROW(static_cast<uint128>(value), std::overflow_error);
+  EXPECT_THROW(uint128(BigInteger(uint256::max())), std::overflow_error);
+}
+
+TEST(BigIntegerBatchTest, KernelsMatchScalarArithmetic) {
+  std::mt19937_64 rng(18);
+  std::vector<BigInteger> lhs;
+  std::vector<BigInteger> rhs;
+  for (int i = 0; i < 1200; ++i) {
+    BigInteger x(random_digits(rng, 1 + rng() % 26));
+    BigInteger y(random_digits(rng, 1 + rng() % 26));
+    lhs.push_back(i % 3 == 0 ? 0LL - x : x);
+    rhs.push_back(i % 4 == 0 ? 0LL - y : y);
+  }
+  rhs[5] = lhs[5];
+  BigIntegerBatch a(lhs, 4);
+  BigIntegerBatch b(rhs, 4);
+  BigIntegerBatch sum(lhs.size(), 4);
+  BigIntegerBatch difference(lhs.size(), 4);
+  BigIntegerBatch scaled(lhs.size(), 4);
+  add_n(sum, a, b);
+  sub_n(difference, a, b);
+  mul_1(scaled, a, 999'999'999);
+  std::vector<int> order = compare(a, b);
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(sum.get(i), lhs[i] + rhs[i]);
+    EXPECT_EQ(difference.get(i), lhs[i] - rhs[i]);
+    EXPECT_EQ(scaled.get(i), lhs[i] * 999'999'999);
+    EXPECT_EQ(order[i], lhs[i] < rhs[i] ? -1 : lhs[i] > rhs[i] ? 1 : 0);
+  }
+  EXPECT_EQ(a.to_vector(), lhs);
+
+  add_n(a, a, a);
+  EXPECT_EQ(a.get(0), lhs[0] * 2);
+  EXPECT_THROW(a.set(0, BigInteger("500000000000000000000000000000000000")),
+               std::overflow_error);
+  a.set(0, BigInteger("-500000000000000000000000000000000000"));
+  EXPECT_EQ(a.get(0), BigInteger("-500000000000000000000000000000000000"));
+  EXPECT_THROW(add_n(sum, a, BigIntegerBatch(3, 4)), std::invalid_argument);
+  EXPECT_THROW(mul_1(scaled, a, 1'000'000'000), std::invalid_argument);
+}
+
+TEST(SerializationTest, RoundTripsWithoutText) {
+  std::mt19937_64 rng(19);
+  std::vector<BigInteger> values = {0LL, 1LL, -1LL, 999'999'999LL};
+  for (int i = 0; i < 200; ++i) {
+    BigInteger value(random_digits(rng, 1 + rng() % 400));
+    values.push_back(i % 2 == 0 ? 0LL - value : value);
+  }
+
+  std::vector<std::byte> bytes = serialize(values);
+  EXPECT_EQ(deserialize(bytes), values);
+  std::vector<BigIntegerView> views = deserialize_views(bytes);
+  ASSERT_EQ(views.size(), values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(views[i], values[i]);
+    EXPECT_EQ(views[i] < views[0], values[i] < 0);
+  }
+  EXPECT_TRUE(views[0].is_zero());
+
+  std::ostringstream stream;
+  serialize(stream, values);
+  std::string text = stream.str();
+  EXPECT_EQ(text.size(), bytes.size());
+  EXPECT_EQ(std::memcmp(text.data(), bytes.data(), bytes.size()), 0);
+}
+
+TEST(SerializationTest, ReadsEitherByteOrderAndRejectsMalformedData) {
+  auto buffer = [](std::initializer_list<int> bytes) {
+    std::vector<std::byte> result;
+    for (int byte : bytes) {
+      result.push_back(static_cast<std::byte>(byte));
+    }
+    return result;
+  };
+  // One value, -(2 * 1e9 + 1), in big-endian limbs.
+  std::vector<std::byte> big_endian = buffer(
+      {'B', 'G', 'I', 'N', 1, 1, 1, 5, 0, 0, 0, 1, 0, 0, 0, 2});
+  EXPECT_EQ(deserialize(big_endian),
+            std::vector<BigInteger>{BigInteger(-2'000'000'001LL)});
+
+  std::vector<std::byte> truncated(big_endian.begin(), big_endian.end() - 1);
+  EXPECT_THROW(deserialize(truncated), std::invalid_argument);
+  big_endian.push_back(std::byte{0});
+  EXPECT_THROW(deserialize(big_endian), std::invalid_argument);
+  EXPECT_THROW(deserialize(buffer({'B', 'G', 'I', 'N', 2, 0, 0})),
+               std::invalid_argument);
+  EXPECT_THROW(deserialize(buffer({'B', 'G', 'I', 'N', 1, 0, 1, 1})),
+               std::invalid_argument);
+  // A ten-byte count whose last byte sets bits past 63.
+  EXPECT_THROW(deserialize(buffer({'B', 'G', 'I', 'N', 1, 0, 0x80, 0x80, 0x80,
+                                   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02})),
+               std::invalid_argument);
+
+  // A limb of 1e9 is well formed but not canonical.
+  std::vector<std::byte> oversized =
+      buffer({'B', 'G', 'I', 'N', 1, 1, 1, 2, 0x3b, 0x9a, 0xca, 0x00});
+  EXPECT_EQ(deserialize_views(oversized)[0][0], 1'000'000'000u);
+  EXPECT_THROW(deserialize(oversized), std::invalid_argument);
+}
+
+TEST(SerializationTest, MapsFilesWithoutCopying) {
+  std::vector<BigInteger> values = {factorial(500), -12345LL, 0LL,
+                                    NthFibonacci(1000)};
+  std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "bigintegers.bin";
+  {
+    std::ofstream file(path, std::ios::binary);
+    serialize(file, values);
+  }
+
+  MappedBigIntegers mapped(path.string());
+  MappedBigIntegers moved = std::move(mapped);
+  EXPECT_EQ(mapped.size(), 0u);
+  ASSERT_EQ(moved.size(), values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(static_cast<BigInteger>(moved[i]), values[i]);
+  }
+  std::filesystem::remove(path);
+
+  EXPECT_THROW(MappedBigIntegers((path / "missing").string()),
+               std::system_error);
+}
+
+TEST(BigRationalTest, LazyReductionMatchesEagerReduction) {
+  auto harmonic = [](int n) {
+    BigRational total;
+    for (int k = 1; k <= n; ++k) {
+      total += BigRational(1LL, BigInteger(static_cast<long long>(k)));
+    }
+    return total;
+  };
+  std::size_t saved = BigRational::reduction_growth();
+  BigRational::reduction_growth() = 0;
+  BigRational eager = harmonic(300);
+  BigRational::reduction_growth() = saved;
+  BigRational lazy = harmonic(300);
+
+  EXPECT_EQ(lazy, eager);
+  EXPECT_EQ(lazy.numerator(), eager.numerator());
+  EXPECT_EQ(lazy.denominator(), eager.denominator());
+  EXPECT_EQ(harmonic(30).to_string(), "9304682830147/2329089562800");
+}
+
+TEST(BigRationalTest, ArithmeticAndOrdering) {
+  BigRational third(1LL, 3LL);
+  BigRational half(BigInteger(-2LL), BigInteger(-4LL));
+  EXPECT_EQ(half, BigRational(1LL, 2LL));
+  EXPECT_EQ(half.numerator(), 1);
+  EXPECT_LT(third, half);
+  EXPECT_LT(BigRational(-1LL, 2LL), third);
+  EXPECT_EQ((third + 2) * 3, BigRational(7));
+  EXPECT_EQ(third - half, BigRational(-1LL, 6LL));
+  EXPECT_EQ(third / half, BigRational(2LL, 3LL));
+  EXPECT_EQ(half - half, BigRational());
+  EXPECT_EQ((third + third).to_string(), "2/3");
+
+  BigRational value = half;
+  value *= value;
+  value /= value;
+  EXPECT_EQ(value, 1);
+  value /= BigInteger(-8LL);
+  std::ostringstream out;
+  out << value;
+  EXPECT_EQ(out.str(), "-1/8");
+
+  EXPECT_THROW(BigRational(1LL, 0LL), std::invalid_argument);
+  EXPECT_THROW(third / BigRational(), std::invalid_argument);
+  EXPECT_THROW(third /= 0, std::invalid_argument);
+}
@@ -0,0 +1,220 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Rational.hpp"
+
+namespace {
+
+// The modulo loop Rational used before the binary gcd, kept as a baseline.
+template <typename Unsigned>
+Unsigned euclidGcd(Unsigned a, Unsigned b)
+{
+    while (b != 0) {
+        Unsigned tmp = b;
+        b = a % b;
+        a = tmp;
+    }
+    return a;
+}
+
+template <typename Unsigned>
+std::vector<Unsigned> randomOperands(std::size_t count)
+{
+    std::mt19937_64 rng(1);
+    std::vector<Unsigned> operands(count);
+    for (Unsigned& operand : operands) {
+        operand = static_cast<Unsigned>(rng());
+        if constexpr (sizeof(Unsigned) > sizeof(std::uint64_t)) {
+            operand = operand << 64 | rng();
+        }
+    }
+    return operands;
+}
+
+template <typename Unsigned, Unsigned (*Gcd)(Unsigned, Unsigned)>
+void BM_Gcd(benchmark::State& state)
+{
+    const std::vector<Unsigned> operands = randomOperands<Unsigned>(1024);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i + 1 < operands.size(); i += 2) {
+            benchmark::DoNotOptimize(Gcd(operands[i], operands[i + 1]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * operands.size() / 2);
+}
+
+// Every step normalizes, so this follows the gcd kernel.
+template <typename Int>
+void BM_Sum(benchmark::State& state)
+{
+    std::mt19937_64 rng(2);
+    std::vector<BasicRational<Int>> terms;
+    for (int i = 0; i < 1024; ++i) {
+        terms.emplace_back(static_cast<Int>(rng() % 1000), static_cast<Int>(rng() % 1000 + 1));
+    }
+    for (auto _ : state) {
+        BasicRational<Int> total;
+        for (const BasicRational<Int>& term : terms) {
+            total = BasicRational<Int>(total.getNumerator() % 1000000, total.getDenomerator()) + term;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * terms.size());
+}
+
+// Dyadic terms, as in fixed-point data, so the running sum stays in range
+// for the loops over the operators that the bulk versions replace.
+template <typename Int>
+std::vector<BasicRational<Int>> dyadicTerms(std::uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<BasicRational<Int>> terms;
+    for (int i = 0; i < 1024; ++i) {
+        terms.emplace_back(static_cast<Int>(rng() % 1000), static_cast<Int>(1) << (rng() % 7));
+    }
+    return terms;
+}
+
+template <typename Int, bool Bulk>
+void BM_BulkSum(benchmark::State& state)
+{
+    const std::vector<BasicRational<Int>> terms = dyadicTerms<Int>(3);
+    for (auto _ : state) {
+        BasicRational<Int> total;
+        if constexpr (Bulk) {
+            total = BasicRational<Int>::sum(terms);
+        } else {
+            for (const BasicRational<Int>& term : terms) {
+                total += term;
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * terms.size());
+}
+
+template <typename Int, bool Bulk>
+void BM_BulkDot(benchmark::State& state)
+{
+    const std::vector<BasicRational<Int>> a = dyadicTerms<Int>(4);
+    const std::vector<BasicRational<Int>> b = dyadicTerms<Int>(5);
+    for (auto _ : state) {
+        BasicRational<Int> total;
+        if constexpr (Bulk) {
+            total = BasicRational<Int>::dot(a, b);
+        } else {
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                total += a[i] * b[i];
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+
+template <typename Int, bool Bulk>
+void BM_BulkMultiply(benchmark::State& state)
+{
+    const std::vector<BasicRational<Int>> a = dyadicTerms<Int>(6);
+    const std::vector<BasicRational<Int>> b = dyadicTerms<Int>(7);
+    std::vector<BasicRational<Int>> out(a.size());
+    for (auto _ : state) {
+        if constexpr (Bulk) {
+            BasicRational<Int>::multiply(a, b, out);
+        } else {
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                out[i] = a[i] * b[i];
+            }
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+
+// Against the stream output displayFraction used, minus the flush.
+template <bool Chars>
+void BM_FormatFraction(benchmark::State& state)
+{
+    const std::vector<Rational64> terms = dyadicTerms<std::int64_t>(8);
+    char buffer[Rational64::MAX_FRACTION_CHARS];
+    std::ostringstream stream;
+    for (auto _ : state) {
+        for (const Rational64& term : terms) {
+            if constexpr (Chars) {
+                benchmark::DoNotOptimize(term.toChars(buffer, buffer + sizeof(buffer)).ptr);
+            } else {
+                stream.str({});
+                stream << term.getNumerator() << '/' << term.getDenomerator();
+                benchmark::DoNotOptimize(stream.tellp());
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * terms.size());
+}
+
+void BM_FormatDecimal(benchmark::State& state)
+{
+    std::mt19937_64 rng(9);
+    std::vector<Rational64> terms;
+    for (int i = 0; i < 1024; ++i) {
+        terms.emplace_back(static_cast<std::int32_t>(rng()), static_cast<std::int64_t>(rng() % 100 + 1));
+    }
+    char buffer[256];
+    for (auto _ : state) {
+        for (const Rational64& term : terms) {
+            benchmark::DoNotOptimize(term.toDecimalChars(buffer, buffer + sizeof(buffer), 40).ptr);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * terms.size());
+}
+
+void BM_ParseFraction(benchmark::State& state)
+{
+    std::vector<std::string> texts;
+    char buffer[Rational64::MAX_FRACTION_CHARS];
+    for (const Rational64& term : dyadicTerms<std::int64_t>(10)) {
+        texts.emplace_back(buffer, term.toChars(buffer, buffer + sizeof(buffer)).ptr);
+    }
+    Rational64 value;
+    for (auto _ : state) {
+        for (const std::string& text : texts) {
+            Rational64::fromChars(text.data(), text.data() + text.size(), value);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * texts.size());
+}
+
+BENCHMARK(BM_Gcd<std::uint32_t, euclidGcd<std::uint32_t>>);
+BENCHMARK(BM_Gcd<std::uint32_t, binaryGcd<std::uint32_t>>);
+BENCHMARK(BM_Gcd<std::uint64_t, euclidGcd<std::uint64_t>>);
+BENCHMARK(BM_Gcd<std::uint64_t, binaryGcd<std::uint64_t>>);
+BENCHMARK(BM_Gcd<unsigned __int128, euclidGcd<unsigned __int128>>);
+BENCHMARK(BM_Gcd<unsigned __int128, binaryGcd<unsigned __int128>>);
+BENCHMARK(BM_Sum<int>);
+BENCHMARK(BM_Sum<std::int64_t>);
+BENCHMARK(BM_BulkSum<int, false>);
+BENCHMARK(BM_BulkSum<int, true>);
+BENCHMARK(BM_BulkSum<std::int64_t, false>);
+BENCHMARK(BM_BulkSum<std::int64_t, true>);
+BENCHMARK(BM_BulkDot<int, false>);
+BENCHMARK(BM_BulkDot<int, true>);
+BENCHMARK(BM_BulkDot<std::int64_t, false>);
+BENCHMARK(BM_BulkDot<std::int64_t, true>);
+BENCHMARK(BM_BulkMultiply<int, false>);
+BENCHMARK(BM_BulkMultiply<int, true>);
+BENCHMARK(BM_BulkMultiply<std::int64_t, false>);
+BENCHMARK(BM_BulkMultiply<std::int64_t, true>);
+BENCHMARK(BM_FormatFraction<false>);
+BENCHMARK(BM_FormatFraction<true>);
+BENCHMARK(BM_FormatDecimal);
+BENCHMARK(BM_ParseFraction);
+
+} // namespace
+
+BENCHMARK_MAIN();
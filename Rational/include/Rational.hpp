@@ -1,43 +1,307 @@
 #ifndef RATIONAL_H
 #define RATIONAL_H
 
+#include <bit>
+#include <charconv>
 #include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
 
-class Rational
+// The type products of two Int values are formed in, and the unsigned type
+// gcds run in. __int128 has nothing wider, so its intermediates are only
+// overflow-checked.
+template <typename Int>
+struct RationalTraits;
+
+template <>
+struct RationalTraits<int>
+{
+    using Wide = long long;
+    using Unsigned = unsigned int;
+};
+
+template <>
+struct RationalTraits<long>
+{
+    using Wide = __int128;
+    using Unsigned = unsigned long;
+};
+
+template <>
+struct RationalTraits<long long>
+{
+    using Wide = __int128;
+    using Unsigned = unsigned long long;
+};
+
+template <>
+struct RationalTraits<__int128>
+{
+    using Wide = __int128;
+    using Unsigned = unsigned __int128;
+};
+
+// std::countr_zero, extended to unsigned __int128.
+template <typename Unsigned>
+constexpr int countTrailingZeros(Unsigned x)
+{
+    if constexpr (sizeof(Unsigned) <= sizeof(std::uint64_t)) {
+        return std::countr_zero(x);
+    } else {
+        const auto low = static_cast<std::uint64_t>(x);
+        return low != 0 ? std::countr_zero(low)
+                        : 64 + std::countr_zero(static_cast<std::uint64_t>(x >> 64));
+    }
+}
+
+// Stein's binary gcd. Each step strips all factors of two with one
+// trailing-zero count and then subtracts, so the loop never divides. The
+// count is taken from the wrapped difference b - a, which has the same
+// trailing zeros as |a - b|, so it overlaps with forming the minimum and
+// the absolute difference instead of waiting on them, and both of those
+// are selects rather than a branch on which operand is larger.
+template <typename Unsigned>
+constexpr Unsigned binaryGcd(Unsigned a, Unsigned b)
+{
+    if (a == 0 || b == 0) {
+        return a | b;
+    }
+    int zeros = countTrailingZeros(a);
+    const int shift = countTrailingZeros(a | b);
+    b >>= countTrailingZeros(b);
+    while (a != 0) {
+        a >>= zeros;
+        zeros = countTrailingZeros(static_cast<Unsigned>(b - a));
+        const Unsigned larger = a > b ? a : b;
+        b = a < b ? a : b;
+        a = larger - b;
+    }
+    return b << shift;
+}
+
+// A fraction in lowest terms with a positive denominator. Sums and products
+// cross-reduce by gcd before multiplying (Knuth, TAOCP 4.5.1) and form
+// their intermediates in the wide type, so a result overflows only when
+// its reduced form does not fit Int. Then Checked throws
+// std::overflow_error; otherwise the result wraps.
+template <typename Int, bool Checked = false>
+class BasicRational
 {
 private:
-    int m_numerator;
-    int m_denomenator;
+    using Wide = typename RationalTraits<Int>::Wide;
+    using Unsigned = typename RationalTraits<Int>::Unsigned;
+    // Running sums of the bulk operations; twice as wide as Int where a
+    // type that wide exists.
+    using Accumulator = typename RationalTraits<Wide>::Wide;
+
+    static constexpr Int MAX = static_cast<Int>(~Unsigned{0} >> 1);
+    static constexpr Int MIN = -MAX - 1;
 
-    void normalize();
-    int gcd(int a, int b) const;
+    Int m_numerator;
+    Int m_denomenator;
+
+    constexpr void normalize();
+    static constexpr Unsigned magnitude(Wide value);
+    template <typename Value>
+    static Int narrow(Value value, bool overflow);
+    static BasicRational reduced(Accumulator numerator, Accumulator denomenator);
+    void add(const BasicRational&, bool subtract);
 public:
-    Rational(int numerator = 0, int denomenator = 1);
+    constexpr BasicRational(Int numerator = 0, Int denomenator = 1);
 
-    int getNumerator() const;
-    int getDenomerator() const;
+    constexpr Int getNumerator() const;
+    constexpr Int getDenomerator() const;
 
-    void setNumerator(int numerator);
-    void setDenomerator(int denomenator);
+    void setNumerator(Int numerator);
+    void setDenomerator(Int denomenator);
 
     void displayFraction() const;
     void displayDecimalFraction() const;
 
+    // Text conversion in the manner of std::to_chars and std::from_chars:
+    // caller buffers, no allocation or locale, and the same std::errc codes
+    // on failure. toChars writes "p/q", at most MAX_FRACTION_CHARS
+    // characters. toDecimalChars writes the exact expansion with its
+    // repeating cycle in parentheses, as in "-1.1(6)" for -7/6; if that
+    // needs more than maxDigits digits after the point, it writes the first
+    // maxDigits of them followed by "...". fromChars reads either form,
+    // without the "...", and reports std::errc::result_out_of_range when the
+    // reduced value does not fit Int or its digits do not fit 128 bits.
+    static constexpr std::size_t MAX_FRACTION_CHARS = 2 * (sizeof(Int) * 8 * 30103 / 100000 + 1) + 2;
+
+    std::to_chars_result toChars(char* first, char* last) const;
+    std::to_chars_result toDecimalChars(char* first, char* last, std::size_t maxDigits = SIZE_MAX) const;
+    static std::from_chars_result fromChars(const char* first, const char* last, BasicRational& value);
+
     explicit operator double() const;
 
-    Rational& operator+= (const Rational&);
-    Rational& operator-= (const Rational&);
-    Rational& operator/= (const Rational&);
-    Rational& operator*= (const Rational&);
+    BasicRational& operator+= (const BasicRational&);
+    BasicRational& operator-= (const BasicRational&);
+    BasicRational& operator/= (const BasicRational&);
+    BasicRational& operator*= (const BasicRational&);
+
+    // Bulk operations for long arrays. sum and dot keep one running
+    // fraction in Accumulator over the least common denominator seen so
+    // far, so runs of equal denominators cost one addition per element and
+    // the gcd reduction happens once at the end; dot forms its products a
+    // block at a time in a loop the compiler vectorizes. multiply writes
+    // a[i] * b[i] to out[i], which may be a or b. Spans of different sizes
+    // throw std::invalid_argument; overflow is handled as by the operators.
+    static BasicRational sum(std::span<const BasicRational> values);
+    static BasicRational dot(std::span<const BasicRational> a, std::span<const BasicRational> b);
+    static void multiply(std::span<const BasicRational> a, std::span<const BasicRational> b,
+                         std::span<BasicRational> out);
+
+    constexpr std::strong_ordering operator<=>(const BasicRational&) const;
+    constexpr bool operator== (const BasicRational&) const;
+    constexpr bool operator!= (const BasicRational&) const;
 
-    std::strong_ordering operator<=>(const Rational&) const;
-    bool operator== (const Rational&) const;
-    bool operator!= (const Rational&) const;
+    friend BasicRational operator+ (const BasicRational& lhs, const BasicRational& rhs)
+    {
+        BasicRational copy = lhs;
+        copy += rhs;
+        return copy;
+    }
 
-    friend Rational operator+ (const Rational&, const Rational&);
-    friend Rational operator- (const Rational&, const Rational&);
-    friend Rational operator/ (const Rational&, const Rational&);
-    friend Rational operator* (const Rational&, const Rational&);
+    friend BasicRational operator- (const BasicRational& lhs, const BasicRational& rhs)
+    {
+        BasicRational copy = lhs;
+        copy -= rhs;
+        return copy;
+    }
+
+    friend BasicRational operator/ (const BasicRational& lhs, const BasicRational& rhs)
+    {
+        BasicRational copy = lhs;
+        copy /= rhs;
+        return copy;
+    }
+
+    friend BasicRational operator* (const BasicRational& lhs, const BasicRational& rhs)
+    {
+        BasicRational copy = lhs;
+        copy *= rhs;
+        return copy;
+    }
 };
 
-#endif
\ No newline at end of file
+template <typename Int, bool Checked>
+constexpr typename BasicRational<Int, Checked>::Unsigned BasicRational<Int, Checked>::magnitude(Wide value)
+{
+    return value < 0 ? Unsigned{0} - static_cast<Unsigned>(value)
+                     : static_cast<Unsigned>(value);
+}
+
+// Works on magnitudes, so a denominator of MIN reduces before its sign
+// moves to the numerator.
+template <typename Int, bool Checked>
+constexpr void BasicRational<Int, Checked>::normalize() {
+    const bool negative = (m_numerator < 0) != (m_denomenator < 0);
+    Unsigned numerator = magnitude(m_numerator);
+    Unsigned denomenator = magnitude(m_denomenator);
+    Unsigned gcd_value = binaryGcd(numerator, denomenator);
+    numerator /= gcd_value;
+    denomenator /= gcd_value;
+
+    const Unsigned limit = static_cast<Unsigned>(MAX) + (negative ? 1 : 0);
+    if ((numerator > limit || denomenator > static_cast<Unsigned>(MAX)) && Checked) {
+        throw std::overflow_error("Rational overflow");
+    }
+    m_numerator = static_cast<Int>(negative ? Unsigned{0} - numerator : numerator);
+    m_denomenator = static_cast<Int>(denomenator);
+}
+
+template <typename Int, bool Checked>
+constexpr BasicRational<Int, Checked>::BasicRational(Int numerator, Int denomenator)
+    : m_numerator(numerator), m_denomenator(denomenator)
+{
+    if (denomenator == 0) {
+        throw std::invalid_argument("Denominator cannot be zero");
+    }
+    normalize();
+}
+
+template <typename Int, bool Checked>
+constexpr Int BasicRational<Int, Checked>::getNumerator() const
+{
+    return m_numerator;
+}
+
+template <typename Int, bool Checked>
+constexpr Int BasicRational<Int, Checked>::getDenomerator() const
+{
+    return m_denomenator;
+}
+
+// Cross-multiplies when the wide type holds the products. Otherwise
+// compares the continued fraction expansions term by term, which never
+// overflows.
+template <typename Int, bool Checked>
+constexpr std::strong_ordering BasicRational<Int, Checked>::operator<=>(const BasicRational& other) const {
+    if constexpr (sizeof(Wide) > sizeof(Int)) {
+        return Wide{m_numerator} * other.m_denomenator <=> Wide{m_denomenator} * other.m_numerator;
+    } else {
+        Int a = m_numerator, b = m_denomenator;
+        Int c = other.m_numerator, d = other.m_denomenator;
+        while (true) {
+            Int q1 = a / b, r1 = a % b;
+            Int q2 = c / d, r2 = c % d;
+            if (r1 < 0) {
+                --q1;
+                r1 += b;
+            }
+            if (r2 < 0) {
+                --q2;
+                r2 += d;
+            }
+            if (q1 != q2 || r1 == 0 || r2 == 0) {
+                return q1 != q2 ? q1 <=> q2 : (r1 != 0) <=> (r2 != 0);
+            }
+            // r1/b against r2/d orders as d/r2 against b/r1.
+            a = d;
+            c = b;
+            b = r2;
+            d = r1;
+        }
+    }
+}
+
+template <typename Int, bool Checked>
+constexpr bool BasicRational<Int, Checked>::operator== (const BasicRational& other) const
+{
+    // Both sides are in lowest terms.
+    return m_numerator == other.m_numerator && m_denomenator == other.m_denomenator;
+}
+
+template <typename Int, bool Checked>
+constexpr bool BasicRational<Int, Checked>::operator!= (const BasicRational& other) const
+{
+    return !(*this == other);
+}
+
+// For generic code that calls to_chars and from_chars unqualified, as it
+// would for the built-in types.
+template <typename Int, bool Checked>
+std::to_chars_result to_chars(char* first, char* last, const BasicRational<Int, Checked>& value)
+{
+    return value.toChars(first, last);
+}
+
+template <typename Int, bool Checked>
+std::from_chars_result from_chars(const char* first, const char* last, BasicRational<Int, Checked>& value)
+{
+    return BasicRational<Int, Checked>::fromChars(first, last, value);
+}
+
+// The members defined in Rational.cpp are instantiated there for these Int
+// types, checked or not.
+using Rational = BasicRational<int>;
+using Rational64 = BasicRational<std::int64_t>;
+using Rational128 = BasicRational<__int128>;
+
+template <typename Int>
+using CheckedRational = BasicRational<Int, true>;
+
+#endif
@@ -1,58 +1,216 @@
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <iomanip>
 
 #include "Rational.hpp"
 
-int Rational::gcd(int a, int b) const
+namespace {
+
+template <typename Wide>
+Wide multiplyWide(Wide a, Wide b, bool& overflow)
+{
+    Wide result;
+    overflow |= __builtin_mul_overflow(a, b, &result);
+    return result;
+}
+
+template <typename Wide>
+Wide addWide(Wide a, Wide b, bool& overflow)
+{
+    Wide result;
+    overflow |= __builtin_add_overflow(a, b, &result);
+    return result;
+}
+
+// Divides a and b, not both zero, by their gcd. 128-bit division and shifts
+// are library calls, so operands that fit in 64 bits are reduced there.
+template <typename Unsigned>
+void divideByGcd(Unsigned& a, Unsigned& b)
 {
-    while (b != 0) {
-        int tmp = b;
-        b = a % b;
-        a = tmp;
+    if constexpr (sizeof(Unsigned) > sizeof(std::uint64_t)) {
+        if ((a | b) >> 64 == 0) {
+            auto narrowA = static_cast<std::uint64_t>(a);
+            auto narrowB = static_cast<std::uint64_t>(b);
+            divideByGcd(narrowA, narrowB);
+            a = narrowA;
+            b = narrowB;
+            return;
+        }
     }
-    return a;
+    const Unsigned g = binaryGcd(a, b);
+    a /= g;
+    b /= g;
 }
 
-void Rational::normalize() {
-    int gcd_value = gcd(std::abs(m_numerator), m_denomenator);
-    m_numerator /= gcd_value;
-    m_denomenator /= gcd_value;
+// Brings n/d, d > 0, to lowest terms.
+template <typename Value>
+void reduce(Value& n, Value& d)
+{
+    using Unsigned = typename RationalTraits<Value>::Unsigned;
+    const bool negative = n < 0;
+    Unsigned numerator = negative ? Unsigned{0} - static_cast<Unsigned>(n) : static_cast<Unsigned>(n);
+    Unsigned denomenator = static_cast<Unsigned>(d);
+    divideByGcd(numerator, denomenator);
+    n = static_cast<Value>(negative ? Unsigned{0} - numerator : numerator);
+    d = static_cast<Value>(denomenator);
 }
 
-Rational::Rational(int numerator, int denomenator)
+// Folds p/q, q > 0, into the running sum n/d. On overflow both fractions
+// are reduced and the step retried once; false means it still overflows.
+template <typename Accumulator>
+bool accumulate(Accumulator& n, Accumulator& d, Accumulator p, Accumulator q)
 {
-    if (denomenator == 0) {
-        throw std::invalid_argument("Denominator cannot be zero");
+    using Unsigned = typename RationalTraits<Accumulator>::Unsigned;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        bool overflow = false;
+        Accumulator numerator;
+        Accumulator denomenator = d;
+        if (q == d) {
+            numerator = addWide(n, p, overflow);
+        } else {
+            // d / g and q / g for g = gcd(d, q).
+            Unsigned dScale = static_cast<Unsigned>(d);
+            Unsigned qScale = static_cast<Unsigned>(q);
+            divideByGcd(dScale, qScale);
+            const auto dFactor = static_cast<Accumulator>(dScale);
+            const auto qFactor = static_cast<Accumulator>(qScale);
+            numerator = addWide(multiplyWide(n, qFactor, overflow), multiplyWide(p, dFactor, overflow),
+                                overflow);
+            denomenator = multiplyWide(d, qFactor, overflow);
+        }
+        if (!overflow) {
+            n = numerator;
+            d = denomenator;
+            return true;
+        }
+        reduce(n, d);
+        reduce(p, q);
     }
+    return false;
+}
 
-    if (denomenator < 0) {
-        m_numerator = -numerator;
-        m_denomenator = -denomenator;
+// Terms per block of the bulk products; small enough for the stack.
+constexpr std::size_t BLOCK = 256;
+
+// Longest run of equal denominators whose numerators are summed in the wide
+// type without overflow checks.
+constexpr std::size_t MAX_RUN = std::size_t{1} << 30;
+
+// std::to_chars has no 128-bit overload in strict mode, so wider values
+// are split into 19-digit pieces that fit 64 bits.
+template <typename Unsigned>
+std::to_chars_result writeDigits(char* first, char* last, Unsigned value)
+{
+    if constexpr (sizeof(Unsigned) <= sizeof(std::uint64_t)) {
+        return std::to_chars(first, last, value);
     } else {
-        m_numerator = numerator;
-        m_denomenator = denomenator;
+        if (value >> 64 == 0) {
+            return std::to_chars(first, last, static_cast<std::uint64_t>(value));
+        }
+        constexpr std::uint64_t PIECE = 10000000000000000000ULL;
+        std::uint64_t low = static_cast<std::uint64_t>(value % PIECE);
+        const auto [next, error] = writeDigits(first, last, value / PIECE);
+        if (error != std::errc{} || last - next < 19) {
+            return {last, std::errc::value_too_large};
+        }
+        for (char* digit = next + 19; digit != next; low /= 10) {
+            *--digit = static_cast<char>('0' + low % 10);
+        }
+        return {next + 19, std::errc{}};
     }
-    normalize();
 }
 
-int Rational::getNumerator() const
+template <typename Unsigned>
+std::to_chars_result writeInteger(char* first, char* last, bool negative, Unsigned magnitude)
 {
-    return m_numerator;
+    if (negative) {
+        if (first == last) {
+            return {last, std::errc::value_too_large};
+        }
+        *first++ = '-';
+    }
+    return writeDigits(first, last, magnitude);
 }
 
-int Rational::getDenomerator() const 
+// The next digit of rest / q, rest < q, leaving the new remainder in rest.
+// rest * 10 can leave Unsigned when q is large; then rest is added ten
+// times instead, which stays below 2q since q is at most half the range.
+template <typename Unsigned>
+char nextDigit(Unsigned& rest, Unsigned q)
 {
-    return m_denomenator;
+    if (q <= ~Unsigned{0} / 10) {
+        rest *= 10;
+        const auto digit = static_cast<char>('0' + rest / q);
+        rest %= q;
+        return digit;
+    }
+    char digit = '0';
+    Unsigned product = 0;
+    for (int i = 0; i < 10; ++i) {
+        product += rest;
+        if (product >= q) {
+            product -= q;
+            ++digit;
+        }
+    }
+    rest = product;
+    return digit;
 }
 
-void Rational::setNumerator(int numenator) 
+std::to_chars_result writeEllipsis(char* first, char* last)
+{
+    if (last - first < 3) {
+        return {last, std::errc::value_too_large};
+    }
+    return {std::fill_n(first, 3, '.'), std::errc{}};
+}
+
+// Appends the decimal digits at first to value. Returns where they end,
+// which is first when there are none.
+template <typename Unsigned>
+const char* readDigits(const char* first, const char* last, Unsigned& value, bool& overflow)
+{
+    for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+        overflow |= __builtin_mul_overflow(value, Unsigned{10}, &value);
+        overflow |= __builtin_add_overflow(value, static_cast<Unsigned>(*first - '0'), &value);
+    }
+    return first;
+}
+
+template <typename Unsigned>
+Unsigned powerOfTen(std::size_t exponent, bool& overflow)
+{
+    Unsigned power = 1;
+    for (std::size_t i = 0; i < exponent; ++i) {
+        overflow |= __builtin_mul_overflow(power, Unsigned{10}, &power);
+    }
+    return power;
+}
+
+} // namespace
+
+template <typename Int, bool Checked>
+template <typename Value>
+Int BasicRational<Int, Checked>::narrow(Value value, bool overflow)
+{
+    if (overflow || value < MIN || value > MAX) {
+        if constexpr (Checked) {
+            throw std::overflow_error("Rational overflow");
+        }
+    }
+    return static_cast<Int>(value);
+}
+
+template <typename Int, bool Checked>
+void BasicRational<Int, Checked>::setNumerator(Int numenator)
 {
     m_numerator = numenator;
     normalize();
 }
 
-void Rational::setDenomerator(int denomenator) 
+template <typename Int, bool Checked>
+void BasicRational<Int, Checked>::setDenomerator(Int denomenator)
 {
     if (denomenator == 0) {
         throw std::invalid_argument("Denominator cannot be zero");
@@ -61,103 +219,346 @@ void Rational::setDenomerator(int denomenator)
     normalize();
 }
 
-Rational& Rational::operator+= (const Rational& other)
+// With d1 = gcd(b, d): a/b + c/d = t / ((b/d1) * (d/d2)), where
+// t = a * (d/d1) + c * (b/d1) and d2 = gcd(t, d1). Both operands are in
+// lowest terms, so the result is too.
+template <typename Int, bool Checked>
+void BasicRational<Int, Checked>::add(const BasicRational& other, bool subtract)
 {
-    m_numerator = m_numerator * other.getDenomerator() + m_denomenator * other.getNumerator();
-    m_denomenator *= other.getDenomerator();
-    normalize();
+    const Int d1 = static_cast<Int>(binaryGcd<Unsigned>(m_denomenator, other.m_denomenator));
+    bool overflow = false;
+    const Wide c = multiplyWide(Wide{other.m_numerator}, Wide{subtract ? -1 : 1}, overflow);
+    const Wide t = addWide(multiplyWide(Wide{m_numerator}, Wide{other.m_denomenator / d1}, overflow),
+                       multiplyWide(c, Wide{m_denomenator / d1}, overflow), overflow);
+    const Int d2 = d1 == 1 ? 1 : static_cast<Int>(binaryGcd<Unsigned>(magnitude(t % d1), d1));
+    m_numerator = narrow(t / d2, overflow);
+    m_denomenator = narrow(multiplyWide(Wide{m_denomenator / d1}, Wide{other.m_denomenator / d2}, overflow),
+                           overflow);
+}
+
+template <typename Int, bool Checked>
+BasicRational<Int, Checked>& BasicRational<Int, Checked>::operator+= (const BasicRational& other)
+{
+    add(other, false);
     return *this;
 }
 
-Rational& Rational::operator-= (const Rational& other)
+template <typename Int, bool Checked>
+BasicRational<Int, Checked>& BasicRational<Int, Checked>::operator-= (const BasicRational& other)
 {
-    m_numerator = m_numerator * other.getDenomerator() - m_denomenator * other.getNumerator();
-    m_denomenator *= other.getDenomerator();
-    normalize();
+    add(other, true);
     return *this;
 }
 
-Rational& Rational::operator/= (const Rational& other)
+template <typename Int, bool Checked>
+BasicRational<Int, Checked>& BasicRational<Int, Checked>::operator/= (const BasicRational& other)
 {
     if (other.m_numerator == 0) {
         throw std::invalid_argument("Cannot divide by zero");
     }
-    m_numerator *= other.getDenomerator();
-    m_denomenator *= other.getNumerator();
-    normalize();
+    const Int g1 = static_cast<Int>(binaryGcd<Unsigned>(magnitude(m_numerator),
+                                        magnitude(other.m_numerator)));
+    const Int g2 = static_cast<Int>(binaryGcd<Unsigned>(m_denomenator, other.m_denomenator));
+    bool overflow = false;
+    Wide numerator = multiplyWide(Wide{m_numerator / g1}, Wide{other.m_denomenator / g2}, overflow);
+    Wide denomenator = multiplyWide(Wide{m_denomenator / g2}, Wide{other.m_numerator / g1}, overflow);
+    if (denomenator < 0) {
+        numerator = multiplyWide(numerator, Wide{-1}, overflow);
+        denomenator = multiplyWide(denomenator, Wide{-1}, overflow);
+    }
+    m_numerator = narrow(numerator, overflow);
+    m_denomenator = narrow(denomenator, overflow);
     return *this;
 }
 
-Rational& Rational::operator*= (const Rational& other)
+// (a/g1 * c/g2) / (b/g2 * d/g1) with g1 = gcd(a, d), g2 = gcd(c, b).
+template <typename Int, bool Checked>
+BasicRational<Int, Checked>& BasicRational<Int, Checked>::operator*= (const BasicRational& other)
 {
-    m_numerator *= other.getNumerator();
-    m_denomenator *= other.getDenomerator();
-    normalize();
+    const Int g1 = static_cast<Int>(binaryGcd<Unsigned>(magnitude(m_numerator), other.m_denomenator));
+    const Int g2 = static_cast<Int>(binaryGcd<Unsigned>(magnitude(other.m_numerator), m_denomenator));
+    bool overflow = false;
+    const Wide numerator = multiplyWide(Wide{m_numerator / g1}, Wide{other.m_numerator / g2}, overflow);
+    const Wide denomenator = multiplyWide(Wide{m_denomenator / g2}, Wide{other.m_denomenator / g1}, overflow);
+    m_numerator = narrow(numerator, overflow);
+    m_denomenator = narrow(denomenator, overflow);
     return *this;
 }
 
-std::strong_ordering Rational::operator<=>(const Rational& other) const {
-    long long lhs = static_cast<long long>(m_numerator) * other.m_denomenator;
-    long long rhs = static_cast<long long>(m_denomenator) * other.m_numerator;
+template <typename Int, bool Checked>
+BasicRational<Int, Checked> BasicRational<Int, Checked>::reduced(Accumulator numerator, Accumulator denomenator)
+{
+    reduce(numerator, denomenator);
+    BasicRational result;
+    result.m_numerator = narrow(numerator, false);
+    result.m_denomenator = narrow(denomenator, false);
+    return result;
+}
 
-    if (lhs < rhs) {
-        return std::strong_ordering::less;
-    } else if (lhs > rhs) {
-        return std::strong_ordering::greater;
-    } else {
-        return std::strong_ordering::equal;
+template <typename Int, bool Checked>
+BasicRational<Int, Checked> BasicRational<Int, Checked>::sum(std::span<const BasicRational> values)
+{
+    Accumulator numerator = 0;
+    Accumulator denomenator = 1;
+    for (std::size_t first = 0; first < values.size();) {
+        const Int q = values[first].m_denomenator;
+        const std::size_t limit = std::min(values.size(), first + MAX_RUN);
+        std::size_t last = first + 1;
+        while (last < limit && values[last].m_denomenator == q) {
+            ++last;
+        }
+
+        bool overflow = false;
+        Accumulator run = 0;
+        if constexpr (sizeof(Wide) > sizeof(Int)) {
+            Wide total = 0;
+            for (std::size_t i = first; i < last; ++i) {
+                total += values[i].m_numerator;
+            }
+            run = total;
+        } else {
+            for (std::size_t i = first; i < last; ++i) {
+                run = addWide(run, Accumulator{values[i].m_numerator}, overflow);
+            }
+        }
+        if (overflow || !accumulate(numerator, denomenator, run, Accumulator{q})) {
+            // Only reachable when a partial sum itself is out of range.
+            BasicRational partial = reduced(numerator, denomenator);
+            for (std::size_t i = first; i < last; ++i) {
+                partial += values[i];
+            }
+            numerator = partial.m_numerator;
+            denomenator = partial.m_denomenator;
+        }
+        first = last;
     }
+    return reduced(numerator, denomenator);
 }
 
-bool Rational::operator== (const Rational& other) const
+template <typename Int, bool Checked>
+BasicRational<Int, Checked> BasicRational<Int, Checked>::dot(std::span<const BasicRational> a,
+                                                             std::span<const BasicRational> b)
 {
- return (*this <=> other) == std::strong_ordering::equal;
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("Spans differ in size");
+    }
+    if constexpr (sizeof(Wide) == sizeof(Int)) {
+        BasicRational total;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            total += a[i] * b[i];
+        }
+        return total;
+    } else {
+        Accumulator numerator = 0;
+        Accumulator denomenator = 1;
+        Wide numerators[BLOCK];
+        Wide denomenators[BLOCK];
+        for (std::size_t first = 0; first < a.size(); first += BLOCK) {
+            const std::size_t count = std::min(BLOCK, a.size() - first);
+            for (std::size_t i = 0; i < count; ++i) {
+                numerators[i] = Wide{a[first + i].m_numerator} * b[first + i].m_numerator;
+                denomenators[i] = Wide{a[first + i].m_denomenator} * b[first + i].m_denomenator;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!accumulate(numerator, denomenator, Accumulator{numerators[i]},
+                                Accumulator{denomenators[i]})) {
+                    BasicRational partial = reduced(numerator, denomenator);
+                    partial += a[first + i] * b[first + i];
+                    numerator = partial.m_numerator;
+                    denomenator = partial.m_denomenator;
+                }
+            }
+        }
+        return reduced(numerator, denomenator);
+    }
 }
 
-bool Rational::operator!= (const Rational& other) const
+template <typename Int, bool Checked>
+void BasicRational<Int, Checked>::multiply(std::span<const BasicRational> a, std::span<const BasicRational> b,
+                                           std::span<BasicRational> out)
 {
-    return !(*this == other);
+    if (a.size() != b.size() || a.size() != out.size()) {
+        throw std::invalid_argument("Spans differ in size");
+    }
+    if constexpr (sizeof(Wide) == sizeof(Int)) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            out[i] = a[i] * b[i];
+        }
+    } else {
+        Wide numerators[BLOCK];
+        Wide denomenators[BLOCK];
+        for (std::size_t first = 0; first < a.size(); first += BLOCK) {
+            const std::size_t count = std::min(BLOCK, a.size() - first);
+            for (std::size_t i = 0; i < count; ++i) {
+                numerators[i] = Wide{a[first + i].m_numerator} * b[first + i].m_numerator;
+                denomenators[i] = Wide{a[first + i].m_denomenator} * b[first + i].m_denomenator;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                if (denomenators[i] != 1) {
+                    reduce(numerators[i], denomenators[i]);
+                }
+                out[first + i].m_numerator = narrow(numerators[i], false);
+                out[first + i].m_denomenator = narrow(denomenators[i], false);
+            }
+        }
+    }
 }
 
-void Rational::displayFraction() const 
+template <typename Int, bool Checked>
+void BasicRational<Int, Checked>::displayFraction() const
 {
-    std::cout << m_numerator << "/" << m_denomenator << std::endl;
+    char buffer[MAX_FRACTION_CHARS];
+    const char* end = toChars(buffer, buffer + sizeof(buffer)).ptr;
+    std::cout.write(buffer, end - buffer) << '\n';
 }
 
-void Rational::displayDecimalFraction() const 
+template <typename Int, bool Checked>
+void BasicRational<Int, Checked>::displayDecimalFraction() const
 {
     double decimalValue = static_cast<double>(m_numerator) / static_cast<double>(m_denomenator);
-    std::cout << std::fixed << std::setprecision(10) << decimalValue << std::endl;
-}
-
-Rational::operator double() const {
-    return static_cast<double>(m_numerator) / static_cast<double>(m_denomenator);
+    std::cout << std::fixed << std::setprecision(10) << decimalValue << '\n';
 }
 
-Rational operator+ (const Rational& lhs, const Rational& rhs)
+template <typename Int, bool Checked>
+std::to_chars_result BasicRational<Int, Checked>::toChars(char* first, char* last) const
 {
-    Rational copy = lhs;
-    copy += rhs;
-    return copy;
+    const auto [next, error] = writeInteger(first, last, m_numerator < 0, magnitude(m_numerator));
+    if (error != std::errc{} || next == last) {
+        return {last, std::errc::value_too_large};
+    }
+    *next = '/';
+    return writeDigits(next + 1, last, static_cast<Unsigned>(m_denomenator));
 }
 
-Rational operator- (const Rational& lhs, const Rational& rhs)
+// The expansion of a reduced p/q repeats from digit max(a, b) on, where 2^a
+// and 5^b are the largest powers of 2 and 5 dividing q, and the cycle ends
+// when the remainder returns to its value there. So it is found without
+// storing the remainders seen.
+template <typename Int, bool Checked>
+std::to_chars_result BasicRational<Int, Checked>::toDecimalChars(char* first, char* last, std::size_t maxDigits) const
 {
-    Rational copy = lhs;
-    copy -= rhs;
-    return copy;
+    const auto q = static_cast<Unsigned>(m_denomenator);
+    Unsigned rest = magnitude(m_numerator);
+    auto [next, error] = writeInteger(first, last, m_numerator < 0, rest / q);
+    rest %= q;
+    if (error != std::errc{} || rest == 0) {
+        return {next, error};
+    }
+    if (maxDigits == 0) {
+        return writeEllipsis(next, last);
+    }
+    if (next == last) {
+        return {last, std::errc::value_too_large};
+    }
+    *next++ = '.';
+
+    std::size_t fives = 0;
+    for (Unsigned factor = q; factor % 5 == 0; factor /= 5) {
+        ++fives;
+    }
+    const std::size_t prefix = std::max<std::size_t>(countTrailingZeros(q), fives);
+    std::size_t digits = 0;
+    for (; digits < prefix; ++digits) {
+        if (digits == maxDigits) {
+            return writeEllipsis(next, last);
+        }
+        if (next == last) {
+            return {last, std::errc::value_too_large};
+        }
+        *next++ = nextDigit(rest, q);
+    }
+    if (rest == 0) {
+        return {next, std::errc{}};
+    }
+
+    // The cycle is written in place and moved right for the '(' once it is
+    // known to fit in maxDigits; a truncated one gets no parentheses.
+    const Unsigned start = rest;
+    char* const cycle = next;
+    do {
+        if (digits++ == maxDigits) {
+            return writeEllipsis(next, last);
+        }
+        if (next == last) {
+            return {last, std::errc::value_too_large};
+        }
+        *next++ = nextDigit(rest, q);
+    } while (rest != start);
+    if (last - next < 2) {
+        return {last, std::errc::value_too_large};
+    }
+    std::copy_backward(cycle, next, next + 1);
+    *cycle = '(';
+    next[1] = ')';
+    return {next + 2, std::errc{}};
 }
 
-Rational operator/ (const Rational& lhs, const Rational& rhs)
+// A decimal with digits A before its cycle, k of them after the point, and
+// digits B through the end of a c-digit cycle is (B - A) / (10^k (10^c - 1)).
+template <typename Int, bool Checked>
+std::from_chars_result BasicRational<Int, Checked>::fromChars(const char* first, const char* last, BasicRational& value)
 {
-    Rational copy = lhs;
-    copy /= rhs;
-    return copy;
+    using Digits = typename RationalTraits<Accumulator>::Unsigned;
+    const bool negative = first != last && *first == '-';
+    const char* next = first + negative;
+    Digits numerator = 0;
+    Digits denomenator = 1;
+    bool overflow = false;
+    const char* end = readDigits(next, last, numerator, overflow);
+    if (end == next) {
+        return {first, std::errc::invalid_argument};
+    }
+    next = end;
+
+    if (next != last && *next == '/') {
+        Digits q = 0;
+        end = readDigits(next + 1, last, q, overflow);
+        if (end != next + 1) {
+            if (q == 0) {
+                return {first, std::errc::invalid_argument};
+            }
+            denomenator = q;
+            next = end;
+        }
+    } else if (next != last && *next == '.') {
+        end = readDigits(next + 1, last, numerator, overflow);
+        denomenator = powerOfTen<Digits>(end - (next + 1), overflow);
+        next = end;
+        Digits through = numerator;
+        bool cycleOverflow = false;
+        end = next != last && *next == '(' ? readDigits(next + 1, last, through, cycleOverflow) : next;
+        if (end != next && end != next + 1 && end != last && *end == ')') {
+            const Digits nines = powerOfTen<Digits>(end - (next + 1), cycleOverflow) - 1;
+            overflow |= cycleOverflow || __builtin_mul_overflow(denomenator, nines, &denomenator);
+            numerator = through - numerator;
+            next = end + 1;
+        }
+    }
+
+    if (overflow) {
+        return {next, std::errc::result_out_of_range};
+    }
+    divideByGcd(numerator, denomenator);
+    const Digits limit = static_cast<Digits>(MAX) + (negative ? 1 : 0);
+    if (numerator > limit || denomenator > static_cast<Digits>(MAX)) {
+        return {next, std::errc::result_out_of_range};
+    }
+    const auto magnitude = static_cast<Unsigned>(numerator);
+    value.m_numerator = static_cast<Int>(negative ? Unsigned{0} - magnitude : magnitude);
+    value.m_denomenator = static_cast<Int>(denomenator);
+    return {next, std::errc{}};
 }
 
-Rational operator* (const Rational& lhs, const Rational& rhs)
-{
-    Rational copy = lhs;
-    copy *= rhs;
-    return copy;
+template <typename Int, bool Checked>
+BasicRational<Int, Checked>::operator double() const {
+    return static_cast<double>(m_numerator) / static_cast<double>(m_denomenator);
 }
+
+template class BasicRational<int>;
+template class BasicRational<int, true>;
+template class BasicRational<long>;
+template class BasicRational<long, true>;
+template class BasicRational<long long>;
+template class BasicRational<long long, true>;
+template class BasicRational<__int128>;
+template class BasicRational<__int128, true>;
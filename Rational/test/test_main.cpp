@@ -1,4 +1,11 @@
 #include <gtest/gtest.h>
+
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "Rational.hpp"
 
 struct CoutRedirect {
@@ -82,3 +89,203 @@ TEST(RationalTest, DivisionByZero) {
     Rational r2(0, 1);
     EXPECT_THROW(r1 / r2, std::invalid_argument);
 }
+
+TEST(RationalTest, CrossReductionAvoidsIntermediateOverflow) {
+    EXPECT_EQ(Rational(1'000'000'000, 3) + Rational(1, 3), Rational(1'000'000'001, 3));
+    EXPECT_EQ(Rational(46'341, 46'343) * Rational(46'343, 46'341), Rational(1));
+    EXPECT_EQ(Rational(46'341, 46'343) / Rational(46'341, 46'343), Rational(1));
+    EXPECT_EQ(Rational64(INT64_MAX, 2) + Rational64(1, 2), Rational64(INT64_C(1) << 62));
+    EXPECT_EQ(Rational(3, -6), Rational(-1, 2));
+
+    Rational r(1, 2);
+    r.setDenomerator(-4);
+    EXPECT_EQ(r.getNumerator(), -1);
+    EXPECT_EQ(r.getDenomerator(), 4);
+}
+
+TEST(RationalTest, CheckedModeReportsOverflow) {
+    using Checked = CheckedRational<int>;
+    EXPECT_THROW(Checked(INT_MAX) + Checked(1), std::overflow_error);
+    EXPECT_THROW(Checked(1, 65'536) * Checked(1, 65'536), std::overflow_error);
+    EXPECT_THROW(Checked(INT_MIN) / Checked(-1), std::overflow_error);
+    EXPECT_EQ(Checked(INT_MIN) - Checked(INT_MIN), Checked(0));
+    EXPECT_EQ(Checked(INT_MAX, 2) + Checked(1, 2), Checked(1 << 30));
+}
+
+TEST(RationalTest, WideComparisonsDoNotOverflow) {
+    const __int128 big = static_cast<__int128>(INT64_MAX) * INT64_MAX;
+    Rational128 below_one(big - 1, big);
+    Rational128 further_below(big - 2, big - 1);
+    EXPECT_EQ(below_one <=> further_below, std::strong_ordering::greater);
+    EXPECT_EQ(Rational128(-big, big - 1) <=> Rational128(-1), std::strong_ordering::less);
+    EXPECT_EQ(below_one * Rational128(big, big - 1), Rational128(1));
+    EXPECT_DOUBLE_EQ(static_cast<double>(Rational128(big, 2 * big)), 0.5);
+}
+
+TEST(RationalTest, NormalizesInConstantExpressions) {
+    static_assert(Rational(6, -8).getNumerator() == -3);
+    static_assert(Rational(6, -8).getDenomerator() == 4);
+    static_assert(Rational(1, 3) < Rational(1, 2));
+    static_assert(Rational128(12, 18) == Rational128(2, 3));
+    constexpr Rational64 quarter(INT64_C(1) << 40, INT64_C(1) << 42);
+    EXPECT_EQ(quarter, Rational64(1, 4));
+}
+
+TEST(RationalTest, BinaryGcdMatchesEuclid) {
+    static_assert(binaryGcd(48u, 18u) == 6u);
+    static_assert(binaryGcd(0u, 7u) == 7u);
+    auto euclid = [](unsigned __int128 a, unsigned __int128 b) {
+        while (b != 0) {
+            unsigned __int128 tmp = b;
+            b = a % b;
+            a = tmp;
+        }
+        return a;
+    };
+    std::mt19937_64 rng(23);
+    for (int i = 0; i < 10000; ++i) {
+        std::uint64_t a = rng() >> (rng() % 64);
+        std::uint64_t b = rng() >> (rng() % 64);
+        EXPECT_EQ(binaryGcd(a, b), std::gcd(a, b));
+        unsigned __int128 wide_a = static_cast<unsigned __int128>(a) * b << (i % 20);
+        unsigned __int128 wide_b = static_cast<unsigned __int128>(b) << 64 | a;
+        EXPECT_TRUE(binaryGcd(wide_a, wide_b) == euclid(wide_a, wide_b));
+    }
+}
+
+template <typename Int>
+void expectBulkMatchesOperators(std::uint64_t seed)
+{
+    using R = BasicRational<Int>;
+    std::mt19937_64 rng(seed);
+    std::vector<R> a, b;
+    for (int i = 0; i < 1000; ++i) {
+        // Mostly shared denominators, for the equal-denominator runs, and
+        // small enough that the operator loops stay in range for int.
+        const auto denomenator = static_cast<Int>(i % 7 == 0 ? rng() % 6 + 1 : 8);
+        a.emplace_back(static_cast<Int>(rng() % 2001) - 1000, denomenator);
+        b.emplace_back(static_cast<Int>(rng() % 201) - 100, static_cast<Int>(rng() % 2 + 1));
+    }
+    R sum, dot;
+    std::vector<R> products;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        sum += a[i];
+        dot += a[i] * b[i];
+        products.push_back(a[i] * b[i]);
+    }
+    EXPECT_EQ(R::sum(a), sum);
+    EXPECT_EQ(R::dot(a, b), dot);
+    EXPECT_EQ(R::sum({}), R(0));
+    R::multiply(a, b, a);
+    EXPECT_EQ(a, products);
+}
+
+TEST(RationalTest, BulkOperationsMatchOperators) {
+    expectBulkMatchesOperators<int>(24);
+    expectBulkMatchesOperators<std::int64_t>(25);
+    expectBulkMatchesOperators<__int128>(26);
+}
+
+TEST(RationalTest, BulkOperationsHandleOverflowAndSizes) {
+    // The partial sums leave int, but the total fits.
+    std::vector<CheckedRational<int>> terms(4, CheckedRational<int>(INT32_MAX / 2 + 1));
+    terms.push_back(CheckedRational<int>(INT32_MIN));
+    terms.push_back(CheckedRational<int>(INT32_MIN));
+    EXPECT_EQ(CheckedRational<int>::sum(terms), CheckedRational<int>(0));
+    terms.pop_back();
+    EXPECT_THROW(CheckedRational<int>::sum(terms), std::overflow_error);
+
+    const __int128 big = static_cast<__int128>(1) << 100;
+    std::vector<CheckedRational<__int128>> wide(3, CheckedRational<__int128>(big, 3));
+    EXPECT_EQ(CheckedRational<__int128>::sum(wide), CheckedRational<__int128>(big));
+    EXPECT_THROW(CheckedRational<__int128>::dot(wide, wide), std::overflow_error);
+
+    std::vector<Rational> a(3), b(2);
+    EXPECT_THROW(Rational::dot(a, b), std::invalid_argument);
+    EXPECT_THROW(Rational::multiply(a, a, b), std::invalid_argument);
+}
+
+template <typename R>
+std::string decimal(const R& value, std::size_t maxDigits = SIZE_MAX)
+{
+    char buffer[64];
+    const auto [end, error] = value.toDecimalChars(buffer, buffer + sizeof(buffer), maxDigits);
+    EXPECT_EQ(error, std::errc{});
+    return std::string(buffer, end);
+}
+
+template <typename R>
+R parse(std::string_view text, std::size_t consumed)
+{
+    R value;
+    const auto [end, error] = from_chars(text.data(), text.data() + text.size(), value);
+    EXPECT_EQ(error, std::errc{}) << text;
+    EXPECT_EQ(end - text.data(), static_cast<std::ptrdiff_t>(consumed)) << text;
+    return value;
+}
+
+TEST(RationalTest, FormatsFractionsAndExactDecimals) {
+    char buffer[Rational::MAX_FRACTION_CHARS];
+    const Rational extreme(INT32_MIN, INT32_MAX);
+    auto [end, error] = to_chars(buffer, buffer + sizeof(buffer), extreme);
+    EXPECT_EQ(std::string(buffer, end), "-2147483648/2147483647");
+    EXPECT_EQ(extreme.toChars(buffer, buffer + 5).ec, std::errc::value_too_large);
+
+    const __int128 big = static_cast<__int128>(INT64_MAX) * INT64_MAX;
+    char wide[Rational128::MAX_FRACTION_CHARS];
+    end = Rational128(-big, 11).toChars(wide, wide + sizeof(wide)).ptr;
+    EXPECT_EQ(std::string(wide, end), "-85070591730234615847396907784232501249/11");
+
+    EXPECT_EQ(decimal(Rational(3, 4)), "0.75");
+    EXPECT_EQ(decimal(Rational(-7, 6)), "-1.1(6)");
+    EXPECT_EQ(decimal(Rational(1, 7)), "0.(142857)");
+    EXPECT_EQ(decimal(Rational(22, 1)), "22");
+    EXPECT_EQ(decimal(Rational(1, 7), 4), "0.1428...");
+    EXPECT_EQ(decimal(Rational(1, 7), 6), "0.(142857)");
+    EXPECT_EQ(decimal(Rational(1, 3), 0), "0...");
+    EXPECT_EQ(decimal(Rational128(1, big), 40), "0.0000000000000000000000000000000000000117...");
+    EXPECT_EQ(decimal(Rational128(big - 1, big), 10), "0.9999999999...");
+    EXPECT_EQ(Rational(1, 7).toDecimalChars(buffer, buffer + 6).ec, std::errc::value_too_large);
+}
+
+TEST(RationalTest, ParsesFractionsAndDecimals) {
+    EXPECT_EQ(parse<Rational>("-6/8", 4), Rational(-3, 4));
+    EXPECT_EQ(parse<Rational>("12 apples", 2), Rational(12));
+    EXPECT_EQ(parse<Rational>("5/x", 1), Rational(5));
+    EXPECT_EQ(parse<Rational>("-1.1(6)", 7), Rational(-7, 6));
+    EXPECT_EQ(parse<Rational>("0.(142857),", 10), Rational(1, 7));
+    EXPECT_EQ(parse<Rational>("0.(9)", 5), Rational(1));
+    EXPECT_EQ(parse<Rational>("2.50(", 4), Rational(5, 2));
+    EXPECT_EQ(parse<Rational>("-2147483648/1", 13), Rational(INT32_MIN));
+    EXPECT_EQ(parse<Rational>("0.000000001", 11), Rational(1, 1000000000));
+
+    Rational value(1, 2);
+    const std::string_view bad[] = {"", "-", "+1", "/2", ".5", "1/0"};
+    for (std::string_view text : bad) {
+        EXPECT_EQ(Rational::fromChars(text.data(), text.data() + text.size(), value).ec,
+                  std::errc::invalid_argument) << text;
+    }
+    const std::string_view large[] = {"2147483648", "1/2147483648", "0.00000000001",
+                                      "1000000000000000000000000000000000000000"};
+    for (std::string_view text : large) {
+        EXPECT_EQ(Rational::fromChars(text.data(), text.data() + text.size(), value).ec,
+                  std::errc::result_out_of_range) << text;
+    }
+    EXPECT_EQ(value, Rational(1, 2));
+
+    // Short cycles, so that every decimal's digits fit 128 bits.
+    std::mt19937_64 rng(25);
+    char buffer[256];
+    for (int i = 0; i < 2000; ++i) {
+        const Rational64 original(static_cast<std::int32_t>(rng()), static_cast<std::int64_t>(rng() % 20 + 1));
+        const char* end = original.toChars(buffer, buffer + sizeof(buffer)).ptr;
+        Rational64 copy;
+        EXPECT_EQ(from_chars(buffer, end, copy).ptr, end);
+        EXPECT_EQ(copy, original);
+        const auto [decimalEnd, error] = original.toDecimalChars(buffer, buffer + sizeof(buffer));
+        ASSERT_EQ(error, std::errc{});
+        copy = Rational64();
+        EXPECT_EQ(from_chars(buffer, decimalEnd, copy).ec, std::errc{});
+        EXPECT_EQ(copy, original);
+    }
+}